@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+BC_USE_LIBBITCOIN_MAIN
+
+using namespace bc::system;
+using namespace bc::system::chain;
+using namespace bc::system::wallet;
+
+typedef std::chrono::steady_clock clock_type;
+
+static const size_t default_outputs = 1000000;
+static const size_t selections = 100;
+static const size_t list_selections = 10;
+
+// Synthetic unspent outputs with log-uniform values from 1k to 10B satoshi.
+static point_value::list make_outputs(size_t count)
+{
+    std::mt19937_64 twister(42);
+    std::uniform_real_distribution<double> exponent(3.0, 10.0);
+    point_value::list outputs;
+    outputs.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        hash_digest hash = null_hash;
+        const auto number = to_little_endian(static_cast<uint64_t>(index));
+        std::copy(number.begin(), number.end(), hash.begin());
+        const auto value = static_cast<uint64_t>(
+            std::pow(10.0, exponent(twister)));
+        outputs.emplace_back(point{ hash, 0 }, value);
+    }
+
+    return outputs;
+}
+
+// Run each selection over the same targets, reporting milliseconds per call.
+template <typename Select>
+static void measure(const std::string& name,
+    const std::vector<uint64_t>& targets, Select select)
+{
+    size_t found = 0;
+    points_value out;
+    const auto start = clock_type::now();
+
+    for (const auto target: targets)
+    {
+        select(out, target);
+        found += out.points.empty() ? 0 : 1;
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed =
+        clock_type::now() - start;
+
+    bc::system::cout << std::left << std::setw(28) << name
+        << std::fixed << std::setprecision(3)
+        << elapsed.count() / targets.size() << " ms/selection, "
+        << found << "/" << targets.size() << " found" << std::endl;
+}
+
+// Benchmark output selection over a synthetic unspent output set.
+// usage: libbitcoin-system-select-outputs [outputs]
+int bc::system::main(int argc, char* argv[])
+{
+    const auto count = argc > 1 ?
+        static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) :
+        default_outputs;
+
+    const points_value list{ make_outputs(count) };
+
+    const auto start = clock_type::now();
+    const points_index index(list.points);
+    const std::chrono::duration<double, std::milli> build =
+        clock_type::now() - start;
+
+    bc::system::cout << count << " outputs, index built in " << std::fixed
+        << std::setprecision(1) << build.count() << " ms" << std::endl;
+
+    std::mt19937_64 twister(7);
+    std::uniform_int_distribution<uint64_t> amount(100000, 1000000000);
+    std::vector<uint64_t> targets(selections);
+
+    for (auto& target: targets)
+        target = amount(twister);
+
+    const auto greedy = select_outputs::algorithm::greedy;
+    const auto individual = select_outputs::algorithm::individual;
+    const auto branch_and_bound = select_outputs::algorithm::branch_and_bound;
+
+    // The list overloads copy and sort the unspent outputs on each call.
+    const std::vector<uint64_t> list_targets(targets.begin(),
+        targets.begin() + list_selections);
+
+    measure("list greedy", list_targets,
+        [&](points_value& out, uint64_t target)
+        {
+            select_outputs::select(out, list, target, greedy);
+        });
+
+    measure("index greedy", targets,
+        [&](points_value& out, uint64_t target)
+        {
+            select_outputs::select(out, index, target, greedy);
+        });
+
+    measure("index individual", targets,
+        [&](points_value& out, uint64_t target)
+        {
+            select_outputs::select(out, index, target, individual);
+        });
+
+    // Typical p2wpkh input fee and change cost at 10 satoshi per vbyte.
+    measure("index branch and bound", targets,
+        [&](points_value& out, uint64_t target)
+        {
+            select_outputs::select(out, index, target, branch_and_bound, 680,
+                3100);
+        });
+
+    return EXIT_SUCCESS;
+}
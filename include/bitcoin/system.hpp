@@ -23,6 +23,8 @@
 #include <bitcoin/system/settings.hpp>
 #include <bitcoin/system/version.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_filter.hpp>
+#include <bitcoin/system/chain/block_view.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/compact.hpp>
 #include <bitcoin/system/chain/header.hpp>
@@ -33,10 +35,12 @@
 #include <bitcoin/system/chain/payment_record.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/point_value.hpp>
+#include <bitcoin/system/chain/points_index.hpp>
 #include <bitcoin/system/chain/points_value.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/stealth_record.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/config/authority.hpp>
 #include <bitcoin/system/config/base16.hpp>
@@ -87,11 +91,13 @@
 #include <bitcoin/system/machine/number.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/machine/operation_view.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/machine/rule_fork.hpp>
 #include <bitcoin/system/machine/script_pattern.hpp>
 #include <bitcoin/system/machine/script_version.hpp>
 #include <bitcoin/system/machine/sighash_algorithm.hpp>
+#include <bitcoin/system/machine/stack_element.hpp>
 #include <bitcoin/system/math/checksum.hpp>
 #include <bitcoin/system/math/crypto.hpp>
 #include <bitcoin/system/math/ec_point.hpp>
@@ -99,18 +105,25 @@
 #include <bitcoin/system/math/elliptic_curve.hpp>
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/math/limits.hpp>
+#include <bitcoin/system/math/murmur3.hpp>
+#include <bitcoin/system/math/point_cache.hpp>
 #include <bitcoin/system/math/ring_signature.hpp>
+#include <bitcoin/system/math/signature_cache.hpp>
+#include <bitcoin/system/math/siphash.hpp>
 #include <bitcoin/system/math/stealth.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 #include <bitcoin/system/message/address.hpp>
 #include <bitcoin/system/message/alert.hpp>
 #include <bitcoin/system/message/alert_payload.hpp>
 #include <bitcoin/system/message/block.hpp>
 #include <bitcoin/system/message/block_transactions.hpp>
+#include <bitcoin/system/message/bloom_filter.hpp>
 #include <bitcoin/system/message/compact_block.hpp>
 #include <bitcoin/system/message/fee_filter.hpp>
 #include <bitcoin/system/message/filter_add.hpp>
 #include <bitcoin/system/message/filter_clear.hpp>
 #include <bitcoin/system/message/filter_load.hpp>
+#include <bitcoin/system/message/frame_writer.hpp>
 #include <bitcoin/system/message/get_address.hpp>
 #include <bitcoin/system/message/get_block_transactions.hpp>
 #include <bitcoin/system/message/get_blocks.hpp>
@@ -126,6 +139,7 @@
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/network_address.hpp>
 #include <bitcoin/system/message/not_found.hpp>
+#include <bitcoin/system/message/partial_block.hpp>
 #include <bitcoin/system/message/ping.hpp>
 #include <bitcoin/system/message/pong.hpp>
 #include <bitcoin/system/message/prefilled_transaction.hpp>
@@ -148,6 +162,7 @@
 #include <bitcoin/system/utility/assert.hpp>
 #include <bitcoin/system/utility/atomic.hpp>
 #include <bitcoin/system/utility/binary.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/collection.hpp>
 #include <bitcoin/system/utility/color.hpp>
 #include <bitcoin/system/utility/conditional_lock.hpp>
@@ -166,8 +181,10 @@
 #include <bitcoin/system/utility/interprocess_lock.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
 #include <bitcoin/system/utility/monitor.hpp>
+#include <bitcoin/system/utility/monotonic_arena.hpp>
 #include <bitcoin/system/utility/noncopyable.hpp>
 #include <bitcoin/system/utility/ostream_writer.hpp>
+#include <bitcoin/system/utility/parallel_for.hpp>
 #include <bitcoin/system/utility/pending.hpp>
 #include <bitcoin/system/utility/png.hpp>
 #include <bitcoin/system/utility/prioritized_mutex.hpp>
@@ -179,6 +196,8 @@
 #include <bitcoin/system/utility/sequencer.hpp>
 #include <bitcoin/system/utility/sequential_lock.hpp>
 #include <bitcoin/system/utility/serializer.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
+#include <bitcoin/system/utility/shared_window.hpp>
 #include <bitcoin/system/utility/socket.hpp>
 #include <bitcoin/system/utility/string.hpp>
 #include <bitcoin/system/utility/subscriber.hpp>
@@ -33,9 +33,11 @@
 #include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/utility/asio.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/thread.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
 #include <bitcoin/system/utility/writer.hpp>
 
 namespace libbitcoin {
@@ -102,6 +104,7 @@ public:
     bool from_data(const data_chunk& data, bool witness=false);
     bool from_data(std::istream& stream, bool witness=false);
     bool from_data(reader& source, bool witness=false);
+    bool from_data(byte_reader& source, bool witness=false);
 
     bool is_valid() const;
 
@@ -179,6 +182,12 @@ public:
     code connect(const chain_state& state) const;
     code connect_transactions(const chain_state& state) const;
 
+    /// Input scripts are verified concurrently on the pool and the calling
+    /// thread, the result is the first failure in block order (if any).
+    code connect(const chain_state& state, threadpool& pool) const;
+    code connect_transactions(const chain_state& state,
+        threadpool& pool) const;
+
     // THIS IS FOR LIBRARY USE ONLY, DO NOT CREATE A DEPENDENCY ON IT.
     mutable validation metadata;
 
@@ -186,6 +195,9 @@ protected:
     void reset();
 
 private:
+    template <class Source>
+    bool deserialize(Source& source, bool witness);
+
     typedef boost::optional<size_t> optional_size;
 
     optional_size total_inputs_cache() const;
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILTER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/siphash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// A BIP158 compact block filter, a Golomb-Rice coded set of the SipHash
+/// values of the block's elements under a key taken from the block hash.
+/// The encoding is the element count followed by the coded deltas, as the
+/// filter of the BIP157 cfilter message.
+class BC_API block_filter
+{
+public:
+    typedef std::vector<block_filter> list;
+
+    /// Basic filter parameters.
+    static const uint8_t basic_type;
+    static const uint8_t basic_rice_bits;
+    static const uint64_t basic_rate;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    block_filter();
+
+    /// Use an encoded filter of the block.
+    block_filter(const hash_digest& block_hash, data_chunk&& encoded);
+    block_filter(const hash_digest& block_hash, const data_chunk& encoded);
+
+    /// Build the basic filter of the block, taking spent output scripts from
+    /// the cached previous outputs of its inputs (as populated by validation).
+    block_filter(const block& block);
+
+    /// Build the basic filter of the block from the outputs that it spends,
+    /// one for each non-coinbase input in block order.
+    block_filter(const block& block, const output::list& spent);
+
+    /// Build the basic filters of the blocks on the pool and calling threads,
+    /// spent output scripts are taken as by the single block constructor.
+    static list basic_filters(const block::list& blocks, threadpool& pool);
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    const hash_digest& block_hash() const;
+    const data_chunk& encoded() const;
+
+    /// The element count, zero if the encoding is invalid.
+    uint64_t size() const;
+
+    /// The filter hash (double sha256 of the encoding).
+    hash_digest hash() const;
+
+    /// The filter header, committing to the filter and the previous header.
+    hash_digest header(const hash_digest& previous_header) const;
+
+    /// The headers of consecutive filters, chained from the previous header
+    /// (null_hash before genesis).
+    static hash_list headers(const list& filters,
+        const hash_digest& previous_header);
+
+    // Matching.
+    //-------------------------------------------------------------------------
+
+    /// True if the element may be in the set, false if it is not.
+    bool match(const data_slice& element) const;
+
+    /// True if any element may be in the set. The queries are hashed and
+    /// sorted once and merged against the set in a single decoding pass.
+    bool match(const data_stack& elements) const;
+
+    bool operator==(const block_filter& other) const;
+    bool operator!=(const block_filter& other) const;
+
+private:
+    typedef std::vector<uint64_t> values;
+
+    static data_chunk encode(const hash_digest& block_hash,
+        std::vector<data_slice>& elements);
+    static void add_outputs(std::vector<data_slice>& elements,
+        const block& block);
+
+    values to_values(const data_stack& elements, uint64_t count) const;
+    bool match(const values& sorted, uint64_t count) const;
+
+    hash_digest block_hash_;
+    data_chunk encoded_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
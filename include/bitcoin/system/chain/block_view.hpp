@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_VIEW_HPP
+
+#include <cstddef>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// A read-only block over a shared, immutable wire serialization, with each
+/// transaction a view into the same buffer (see transaction_view).
+class BC_API block_view
+{
+public:
+    typedef transaction_view::buffer_ptr buffer_ptr;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    block_view();
+
+    // Deserialization.
+    //-------------------------------------------------------------------------
+
+    static block_view factory(data_chunk&& data);
+    static block_view factory(const buffer_ptr& buffer);
+
+    bool from_data(data_chunk&& data);
+    bool from_data(const buffer_ptr& buffer);
+
+    bool is_valid() const;
+
+    // Serialization.
+    //-------------------------------------------------------------------------
+
+    /// The wire serialization, as parsed (with witnesses, if present).
+    data_slice data() const;
+    size_t serialized_size() const;
+
+    /// Copy into an owned block.
+    block to_block(bool witness=true) const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    /// Parsed from the buffer on each call, not cached.
+    chain::header header() const;
+    hash_digest hash() const;
+
+    const transaction_view::list& transactions() const;
+
+    // Validation.
+    //-------------------------------------------------------------------------
+
+    hash_digest generate_merkle_root(bool witness=false) const;
+    bool is_valid_merkle_root() const;
+
+protected:
+    void reset();
+
+private:
+    buffer_ptr buffer_;
+    size_t size_;
+    transaction_view::list transactions_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
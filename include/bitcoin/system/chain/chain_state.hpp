@@ -22,13 +22,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <deque>
 #include <bitcoin/system/config/checkpoint.hpp>
 #include <bitcoin/system/constants.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/rule_fork.hpp>
+#include <bitcoin/system/utility/shared_window.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -43,9 +43,12 @@ class header;
 class BC_API chain_state
 {
 public:
-    typedef std::deque<uint32_t> bitss;
-    typedef std::deque<uint32_t> versions;
-    typedef std::deque<uint32_t> timestamps;
+    /// History windows are shared between parent and child states. They are
+    /// appended and trimmed like a deque but do not support resize, push_front
+    /// or mutable iteration, so populate a container and assign it instead.
+    typedef shared_window<uint32_t> bitss;
+    typedef shared_window<uint32_t> versions;
+    typedef shared_window<uint32_t> timestamps;
     typedef struct { size_t count; size_t high; } range;
 
     typedef std::shared_ptr<chain_state> ptr;
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -34,6 +35,9 @@ public:
     /// Construct a normal form compact number from a 32 bit compact number.
     explicit compact(uint32_t compact);
 
+    /// Construct a normal form compact number from a 256 bit number
+    explicit compact(const uint256& big);
+
     /// Construct a normal form compact number from a 256 bit number
     explicit compact(const uint256_t& big);
 
@@ -46,13 +50,16 @@ public:
 
     /// Big number that the compact number represents.
     /// This is either saved or generated from the construction parameter.
-    operator const uint256_t&() const;
+    const uint256& big() const;
+
+    /// Big number that the compact number represents, as multiprecision.
+    operator uint256_t() const;
 
 private:
-    static bool from_compact(uint256_t& out, uint32_t compact);
-    static uint32_t from_big(const uint256_t& big);
+    static bool from_compact(uint256& out, uint32_t compact);
+    static uint32_t from_big(const uint256& big);
 
-    uint256_t big_;
+    uint256 big_;
     uint32_t normal_;
     bool overflowed_;
 };
@@ -29,6 +29,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/thread.hpp>
@@ -39,6 +40,12 @@ namespace system {
 
 class settings;
 
+namespace message {
+
+class headers;
+
+} // namespace message
+
 namespace chain {
 
 class BC_API header
@@ -123,6 +130,7 @@ public:
     bool from_data(const data_chunk& data, bool wire=true);
     bool from_data(std::istream& stream, bool wire=true);
     bool from_data(reader& source, bool wire=true);
+    bool from_data(byte_reader& source, bool wire=true);
     bool from_data(reader& source, hash_digest&& hash, bool wire=true);
     bool from_data(reader& source, const hash_digest& hash, bool wire=true);
 
@@ -189,7 +197,15 @@ protected:
     void reset();
     void invalidate_cache() const;
 
+    // So that headers may cache hashes computed in parallel lanes.
+    friend class message::headers;
+
+    void cache_hash(const hash_digest& hash) const;
+
 private:
+    template <class Source>
+    bool deserialize(Source& source);
+
     typedef std::shared_ptr<hash_digest> hash_ptr;
 
     hash_ptr hash_cache() const;
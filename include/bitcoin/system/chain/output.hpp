@@ -27,6 +27,7 @@
 #include <vector>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/thread.hpp>
 #include <bitcoin/system/utility/writer.hpp>
@@ -92,6 +93,7 @@ public:
     bool from_data(const data_chunk& data, bool wire=true);
     bool from_data(std::istream& stream, bool wire=true);
     bool from_data(reader& source, bool wire=true, bool unused=false);
+    bool from_data(byte_reader& source, bool wire=true, bool unused=false);
 
     bool is_valid() const;
 
@@ -139,6 +141,9 @@ protected:
     void invalidate_cache() const;
 
 private:
+    template <class Source>
+    bool deserialize(Source& source, bool wire);
+
     typedef std::shared_ptr<wallet::payment_address::list> addresses_ptr;
 
     addresses_ptr addresses_cache() const;
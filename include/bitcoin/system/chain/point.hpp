@@ -26,6 +26,7 @@
 #include <boost/functional/hash.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/writer.hpp>
@@ -76,6 +77,7 @@ public:
     bool from_data(const data_chunk& data, bool wire=true);
     bool from_data(std::istream& stream, bool wire=true);
     bool from_data(reader& source, bool wire=true);
+    bool from_data(byte_reader& source, bool wire=true);
 
     bool is_valid() const;
 
@@ -116,6 +118,9 @@ protected:
     void reset();
 
 private:
+    template <class Source>
+    bool deserialize(Source& source, bool wire);
+
     hash_digest hash_;
     uint32_t index_;
     bool valid_;
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_POINTS_INDEX_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_POINTS_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include <bitcoin/system/chain/point_value.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// A set of valued points maintained in ascending order by value (and then by
+/// point), for repeated output selection over a slowly changing unspent set.
+/// Insert, erase, bounds and running totals are logarithmic in size.
+class BC_API points_index
+{
+private:
+    struct node
+    {
+        point_value point;
+        uint64_t priority;
+        uint64_t sum;
+        size_t count;
+        size_t parent;
+        size_t left;
+        size_t right;
+    };
+
+public:
+    /// Bidirectional iteration in ascending order by value.
+    class BC_API const_iterator
+      : public boost::iterator_facade<const_iterator, const point_value,
+            boost::bidirectional_traversal_tag>
+    {
+    public:
+        const_iterator();
+
+    private:
+        friend class points_index;
+        friend class boost::iterator_core_access;
+
+        const_iterator(const points_index* index, size_t position);
+
+        const point_value& dereference() const;
+        bool equal(const const_iterator& other) const;
+        void increment();
+        void decrement();
+
+        const points_index* index_;
+        size_t position_;
+    };
+
+    points_index();
+
+    /// Index the points, sorting once.
+    points_index(const point_value::list& points);
+
+    /// Add a valued point, preserving order.
+    void insert(const point_value& point);
+
+    /// Remove a valued point, false if not found.
+    bool erase(const point_value& point);
+
+    /// Remove all points.
+    void clear();
+
+    /// The number of indexed points.
+    size_t size() const;
+
+    /// True if there are no indexed points.
+    bool empty() const;
+
+    /// Total value of the indexed points.
+    uint64_t value() const;
+
+    /// Total value of the points preceding the position.
+    uint64_t value(const const_iterator& position) const;
+
+    /// The first point with a value not less than the given value.
+    const_iterator lower_bound(uint64_t value) const;
+
+    /// The first point with a value greater than the given value.
+    const_iterator upper_bound(uint64_t value) const;
+
+    /// The first point at which the running total of values (inclusive of the
+    /// point) exceeds the given total, or end if the total is not exceeded.
+    const_iterator partition_point(uint64_t total) const;
+
+    /// Ascending by value.
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    typedef std::vector<node> nodes;
+
+    size_t allocate(const point_value& point);
+    void release(size_t position);
+    void update(size_t position);
+    size_t count(size_t position) const;
+    uint64_t sum(size_t position) const;
+    size_t first(size_t position) const;
+    size_t last(size_t position) const;
+    size_t next(size_t position) const;
+    size_t previous(size_t position) const;
+    void rotate(size_t position);
+
+    // A treap, with nodes pooled by position and subtrees summarized.
+    nodes nodes_;
+    std::vector<size_t> free_;
+    size_t root_;
+    uint64_t seed_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
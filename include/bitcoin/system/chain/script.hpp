@@ -32,6 +32,7 @@
 #include <bitcoin/system/machine/rule_fork.hpp>
 #include <bitcoin/system/machine/script_pattern.hpp>
 #include <bitcoin/system/machine/script_version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/thread.hpp>
@@ -87,6 +88,7 @@ public:
     bool from_data(const data_chunk& encoded, bool prefix);
     bool from_data(std::istream& stream, bool prefix);
     bool from_data(reader& source, bool prefix);
+    bool from_data(byte_reader& source, bool prefix);
 
     /// Deserialization invalidates the iterator.
     void from_operations(operation::list&& ops);
@@ -126,6 +128,9 @@ public:
     size_t serialized_size(bool prefix) const;
     const operation::list& operations() const;
 
+    /// The encoded operations (without prefix), referenced for decoding.
+    data_slice encoded() const;
+
     // Signing.
     //-------------------------------------------------------------------------
 
@@ -135,11 +140,15 @@ public:
         uint64_t value=max_uint64);
 
     static bool check_signature(const ec_signature& signature,
-        uint8_t sighash_type, const data_chunk& public_key,
+        uint8_t sighash_type, const data_slice& public_key,
         const script& script_code, const transaction& tx, uint32_t input_index,
         script_version version=script_version::unversioned,
         uint64_t value=max_uint64);
 
+    /// Check against a generated signature hash, so it may be reused.
+    static bool check_signature(const ec_signature& signature,
+        const data_slice& public_key, const hash_digest& sighash);
+
     static bool create_endorsement(endorsement& out, const ec_secret& secret,
         const script& prevout_script, const transaction& tx,
         uint32_t input_index, uint8_t sighash_type,
@@ -227,6 +236,9 @@ protected:
     bool is_pay_to_script_hash(uint32_t forks) const;
 
 private:
+    template <class Source>
+    bool deserialize(Source& source, bool prefix);
+
     static size_t serialized_size(const operation::list& ops);
     static data_chunk operations_to_data(const operation::list& ops);
     static hash_digest generate_unversioned_signature_hash(
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_HPP
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <istream>
@@ -36,6 +37,7 @@
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/rule_fork.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/thread.hpp>
 #include <bitcoin/system/utility/writer.hpp>
@@ -128,6 +130,7 @@ public:
     bool from_data(const data_chunk& data, bool wire=true, bool witness=false);
     bool from_data(std::istream& stream, bool wire=true, bool witness=false);
     bool from_data(reader& source, bool wire=true, bool witness=false);
+    bool from_data(byte_reader& source, bool wire=true, bool witness=false);
 
     // Non-wire store deserializations to preserve hash.
     bool from_data(reader& source, hash_digest&& hash, bool wire=true, bool witness=false);
@@ -173,12 +176,26 @@ public:
     hash_digest sequences_hash() const;
     hash_digest hash(bool witness=false) const;
 
+    /// The midstate of the first 64 bytes of the bip143 signature hash
+    /// preimage (version, inpoints hash, sequences hash or null hash).
+    static BC_CONSTEXPR size_t signature_midstate_size = 64;
+    sha256_state signature_midstate(bool all) const;
+
+    /// The hashes of the transactions, uncached hashes are batch computed.
+    static hash_list hashes(const list& transactions, bool witness=false);
+
     // Utilities.
     //-------------------------------------------------------------------------
 
     /// Clear witness from all inputs (does not change default hash).
     void strip_witness();
 
+    /// Populate the cached values used in validation, after which they are
+    /// read without locking. Freezing is not thread safe, and must not be
+    /// concurrent with any other call. Modification thaws the transaction.
+    void freeze() const;
+    bool is_frozen() const;
+
     // Validation.
     //-------------------------------------------------------------------------
 
@@ -222,30 +239,45 @@ protected:
     bool all_inputs_final() const;
 
 private:
-    typedef std::shared_ptr<hash_digest> hash_ptr;
+    template <class Source>
+    bool deserialize(Source& source, bool wire, bool witness);
+
     typedef boost::optional<uint64_t> optional_value;
 
-    hash_ptr hash_cache() const;
-    optional_value total_input_value_cache() const;
-    optional_value total_output_value_cache() const;
+    // Values derived from the transaction, allocated on first use.
+    struct cache
+    {
+        boost::optional<hash_digest> hash;
+        boost::optional<hash_digest> witness_hash;
+        boost::optional<hash_digest> outputs_hash;
+        boost::optional<hash_digest> inpoints_hash;
+        boost::optional<hash_digest> sequences_hash;
+        boost::optional<sha256_state> midstate;
+        boost::optional<sha256_state> midstate_all;
+        boost::optional<bool> segregated;
+        optional_value total_output_value;
+
+        // This depends on prevouts so is never frozen.
+        optional_value total_input_value;
+    };
+
+    typedef std::unique_ptr<cache> cache_ptr;
+
+    template <typename Value, typename Function>
+    Value cached(boost::optional<Value> cache::* value,
+        Function compute) const;
+    cache_ptr cache_copy() const;
+    cache& cache_values() const;
 
     uint32_t version_;
     uint32_t locktime_;
     input::list inputs_;
     output::list outputs_;
 
-    // These share a mutex as they are not expected to contend.
-    mutable hash_ptr hash_;
-    mutable hash_ptr witness_hash_;
-    mutable hash_ptr outputs_hash_;
-    mutable hash_ptr inpoints_hash_;
-    mutable hash_ptr sequences_hash_;
-    mutable upgrade_mutex hash_mutex_;
-
-    // These share a mutex as they are not expected to contend.
-    mutable optional_value total_input_value_;
-    mutable optional_value total_output_value_;
-    mutable boost::optional<bool> segregated_;
+    // The cache is protected by mutex, except that once frozen it is read
+    // without locking (other than total input value, which is not frozen).
+    mutable cache_ptr cache_;
+    mutable std::atomic<bool> frozen_;
     mutable upgrade_mutex mutex_;
 };
 
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/monotonic_arena.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// A read-only transaction over a shared, immutable wire serialization.
+/// Only element offsets are parsed, values are read from the buffer on
+/// demand and the buffer is retained by each view that references it.
+class BC_API transaction_view
+{
+public:
+    typedef std::vector<transaction_view> list;
+    typedef std::shared_ptr<const data_chunk> buffer_ptr;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    transaction_view();
+
+    /// Copies allocate offsets from the free store, never from an arena, so
+    /// that an arena is only used by the thread that deserialized its views.
+    transaction_view(transaction_view&& other);
+    transaction_view(const transaction_view& other);
+
+    // Operators.
+    //-------------------------------------------------------------------------
+
+    transaction_view& operator=(transaction_view&& other);
+    transaction_view& operator=(const transaction_view& other);
+
+    // Deserialization.
+    //-------------------------------------------------------------------------
+
+    static transaction_view factory(data_chunk&& data);
+    static transaction_view factory(const buffer_ptr& buffer,
+        size_t offset=0);
+
+    /// The wire serialization (with witness, if present) must begin at the
+    /// offset, and may be followed by other data.
+    bool from_data(data_chunk&& data);
+    bool from_data(const buffer_ptr& buffer, size_t offset=0);
+
+    /// Offsets are allocated from the arena, which is retained by the view.
+    /// The arena is not thread safe, and copies of the view do not use it.
+    bool from_data(const buffer_ptr& buffer, size_t offset,
+        const monotonic_arena::ptr& arena);
+
+    bool is_valid() const;
+
+    // Serialization.
+    //-------------------------------------------------------------------------
+
+    /// The wire serialization, as parsed (with witness, if present).
+    data_slice data() const;
+    size_t serialized_size() const;
+
+    /// Copy into an owned transaction.
+    transaction to_transaction(bool witness=true) const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    uint32_t version() const;
+    uint32_t locktime() const;
+
+    size_t inputs_size() const;
+    point previous_output(size_t input) const;
+    data_slice input_script(size_t input) const;
+    uint32_t sequence(size_t input) const;
+
+    /// The serialized witness stack of the input (empty if none).
+    data_slice witness(size_t input) const;
+
+    size_t outputs_size() const;
+    uint64_t output_value(size_t output) const;
+    data_slice output_script(size_t output) const;
+
+    /// Computed from the buffer on each call, not cached.
+    hash_digest hash(bool witness=false) const;
+
+    /// The hashes of the transactions, batch computed from the buffers.
+    static hash_list hashes(const list& transactions, bool witness=false);
+
+    // Validation.
+    //-------------------------------------------------------------------------
+
+    bool is_coinbase() const;
+    bool is_segregated() const;
+
+    /// The offset storage of a transaction with the given counts, excluding
+    /// arena alignment padding.
+    static size_t offsets_size(size_t inputs, size_t outputs);
+
+protected:
+    void reset();
+
+private:
+    // Scripts and witnesses are offsets of their data, excluding prefix.
+    struct input_offsets
+    {
+        size_t point;
+        size_t script;
+        size_t script_size;
+        size_t witness;
+        size_t witness_size;
+    };
+
+    struct output_offsets
+    {
+        size_t value;
+        size_t script;
+        size_t script_size;
+    };
+
+    typedef arena_allocator<input_offsets> input_allocator;
+    typedef arena_allocator<output_offsets> output_allocator;
+    typedef std::vector<input_offsets, input_allocator> input_list;
+    typedef std::vector<output_offsets, output_allocator> output_list;
+
+    const uint8_t* at(size_t offset) const;
+    bool is_contiguous() const;
+    data_chunk to_stripped() const;
+
+    buffer_ptr buffer_;
+    size_t offset_;
+    size_t size_;
+
+    // The non-witness body (inputs and outputs), preceding the locktime.
+    size_t body_;
+    size_t body_size_;
+    bool segregated_;
+
+    input_list inputs_;
+    output_list outputs_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
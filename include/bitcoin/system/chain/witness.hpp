@@ -25,6 +25,7 @@
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
 #include <bitcoin/system/utility/thread.hpp>
@@ -76,6 +77,7 @@ public:
     bool from_data(const data_chunk& encoded, bool prefix);
     bool from_data(std::istream& stream, bool prefix);
     bool from_data(reader& source, bool prefix);
+    bool from_data(byte_reader& source, bool prefix);
 
     /// The witness deserialized ccording to count and size prefixing.
     bool is_valid() const;
@@ -131,6 +133,9 @@ protected:
     void reset();
 
 private:
+    template <class Source>
+    bool deserialize(Source& source, bool prefix);
+
     static size_t serialized_size(const data_stack& stack);
     static operation::list to_pay_key_hash(data_chunk&& program);
 
@@ -22,6 +22,7 @@
 #include <string>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/string.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -45,6 +46,14 @@ bool decode_base58(byte_array<Size>& out, const std::string& in);
 template <size_t Size>
 byte_array<Size * 733 / 1000> base58_literal(const char(&string)[Size]);
 
+/**
+ * Encode fixed size data as base58 (e.g. 25 byte payment addresses and
+ * 82 byte extended keys), with intermediates sized at compile time.
+ * @return the base58 encoded string.
+ */
+template <size_t Size>
+std::string encode_base58(const byte_array<Size>& unencoded);
+
 /**
  * Encode data as base58.
  * @return the base58 encoded string.
@@ -52,11 +61,29 @@ byte_array<Size * 733 / 1000> base58_literal(const char(&string)[Size]);
 BC_API std::string encode_base58(const data_slice& unencoded);
 
 /**
- * Attempt to decode base58 data.
+ * Encode data as base58 into the caller's string, reusing its capacity.
+ */
+BC_API void encode_base58(std::string& out, const data_slice& unencoded);
+
+/**
+ * Encode each element of a batch as base58, reusing the capacity of the
+ * caller's strings and a single intermediate buffer across elements.
+ */
+BC_API void encode_base58(string_list& out, const data_stack& unencoded);
+
+/**
+ * Attempt to decode base58 data, reusing the capacity of out.
  * @return false if the input contains non-base58 characters.
  */
 BC_API bool decode_base58(data_chunk& out, const std::string& in);
 
+/**
+ * Attempt to decode each element of a batch of base58 data.
+ * @return false if any input contains non-base58 characters, in which case
+ * out is unchanged.
+ */
+BC_API bool decode_base58(data_stack& out, const string_list& in);
+
 } // namespace system
 } // namespace libbitcoin
 
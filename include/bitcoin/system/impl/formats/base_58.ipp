@@ -19,25 +19,46 @@
 #ifndef LIBBITCOIN_SYSTEM_BASE_58_IPP
 #define LIBBITCOIN_SYSTEM_BASE_58_IPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <bitcoin/system/utility/assert.hpp>
 #include <bitcoin/system/utility/data.hpp>
 
 namespace libbitcoin {
 namespace system {
 
+// For support of template implementation only, do not call directly.
+// Base 58^5 limbs required to encode a number of (non-zero prefixed) bytes.
+constexpr size_t base58_encode_limbs(size_t bytes)
+{
+    // log(256) / log(58), rounded up, over five digits per limb.
+    return bytes * 138 / 500 + 1;
+}
+
+// For support of template implementation only, do not call directly.
+// Base 2^32 limbs required to decode to a number of bytes.
+constexpr size_t base58_decode_limbs(size_t bytes)
+{
+    return bytes / sizeof(uint32_t) + 1;
+}
+
+// For support of template implementation only, do not call directly.
+BC_API void encode_base58_private(std::string& out, uint32_t* limbs,
+    const uint8_t* in, size_t in_size);
+
 // For support of template implementation only, do not call directly.
 BC_API bool decode_base58_private(uint8_t* out, size_t out_size,
-    const char* in);
+    uint32_t* limbs, size_t limbs_size, const char* in, size_t in_size);
 
 template <size_t Size>
 bool decode_base58(byte_array<Size>& out, const std::string& in)
 {
-    byte_array<Size> result;
-    if (!decode_base58_private(result.data(), result.size(), in.data()))
-        return false;
-
-    out = result;
-    return true;
+    // The output is written only if decoding succeeds.
+    std::array<uint32_t, base58_decode_limbs(Size)> limbs;
+    return decode_base58_private(out.data(), out.size(), limbs.data(),
+        limbs.size(), in.data(), in.size());
 }
 
 // TODO: determine if the sizing function is always accurate.
@@ -46,12 +67,25 @@ byte_array<Size * 733 / 1000> base58_literal(const char(&string)[Size])
 {
     // log(58) / log(256), rounded up.
     byte_array<Size * 733 / 1000> out;
+    std::array<uint32_t, base58_decode_limbs(Size * 733 / 1000)> limbs;
+
+    // The literal size includes its null terminator.
     DEBUG_ONLY(const auto success =) decode_base58_private(out.data(),
-        out.size(), string);
+        out.size(), limbs.data(), limbs.size(), string, Size - 1);
     BITCOIN_ASSERT(success);
     return out;
 }
 
+template <size_t Size>
+std::string encode_base58(const byte_array<Size>& unencoded)
+{
+    // Sized for the worst case, where there are no leading zeros.
+    std::string out;
+    std::array<uint32_t, base58_encode_limbs(Size)> limbs;
+    encode_base58_private(out, limbs.data(), unencoded.data(), Size);
+    return out;
+}
+
 } // namespace system
 } // namespace libbitcoin
 
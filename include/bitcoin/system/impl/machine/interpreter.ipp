@@ -21,14 +21,17 @@
 
 #include <cstdint>
 #include <utility>
+#include <boost/optional.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/elliptic_curve.hpp>
+#include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/machine/number.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/machine/operation_view.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/utility/assert.hpp>
 #include <bitcoin/system/utility/data.hpp>
@@ -65,17 +68,19 @@ inline interpreter::result interpreter::op_push_number(program& program,
 }
 
 inline interpreter::result interpreter::op_push_size(program& program,
-    const operation& op)
+    const operation_view& op)
 {
-    if (op.data().size() > op_75)
+    const auto data = op.data();
+
+    if (data.size() > op_75)
         return error::op_push_size;
 
-    program.push_copy(op.data());
+    program.push_copy(data);
     return error::success;
 }
 
 inline interpreter::result interpreter::op_push_data(program& program,
-    const data_chunk& data, uint32_t size_limit)
+    const data_slice& data, uint32_t size_limit)
 {
     if (data.size() > size_limit)
         return error::op_push_data;
@@ -604,7 +609,7 @@ inline interpreter::result interpreter::op_ripemd160(program& program)
     if (program.empty())
         return error::op_ripemd160;
 
-    program.push_move(ripemd160_hash_chunk(program.pop()));
+    program.push_move(ripemd160_hash(program.pop()));
     return error::success;
 }
 
@@ -613,7 +618,7 @@ inline interpreter::result interpreter::op_sha1(program& program)
     if (program.empty())
         return error::op_sha1;
 
-    program.push_move(sha1_hash_chunk(program.pop()));
+    program.push_move(sha1_hash(program.pop()));
     return error::success;
 }
 
@@ -622,7 +627,7 @@ inline interpreter::result interpreter::op_sha256(program& program)
     if (program.empty())
         return error::op_sha256;
 
-    program.push_move(sha256_hash_chunk(program.pop()));
+    program.push_move(sha256_hash(program.pop()));
     return error::success;
 }
 
@@ -631,7 +636,7 @@ inline interpreter::result interpreter::op_hash160(program& program)
     if (program.empty())
         return error::op_hash160;
 
-    program.push_move(ripemd160_hash_chunk(sha256_hash(program.pop())));
+    program.push_move(ripemd160_hash(sha256_hash(program.pop())));
     return error::success;
 }
 
@@ -640,12 +645,12 @@ inline interpreter::result interpreter::op_hash256(program& program)
     if (program.empty())
         return error::op_hash256;
 
-    program.push_move(sha256_hash_chunk(sha256_hash(program.pop())));
+    program.push_move(sha256_hash(sha256_hash(program.pop())));
     return error::success;
 }
 
 inline interpreter::result interpreter::op_codeseparator(program& program,
-    const operation& op)
+    const operation_view& op)
 {
     return program.set_jump_register(op, + 1) ? error::success :
         error::op_code_seperator;
@@ -663,7 +668,7 @@ inline interpreter::result interpreter::op_check_sig_verify(program& program)
     auto bip143 = chain::script::is_enabled(program.forks(), bip143_rule);
 
     const auto public_key = program.pop();
-    auto endorsement = program.pop();
+    auto endorsement = to_chunk(program.pop());
 
     // Create a subscript with endorsements stripped (sort of).
     chain::script script_code(program.subscript());
@@ -742,6 +747,8 @@ inline interpreter::result interpreter::op_check_multisig_verify(
     uint8_t sighash;
     ec_signature signature;
     der_signature distinguished;
+    hash_digest signature_hash;
+    boost::optional<uint8_t> hashed;
     auto endorsement = endorsements.begin();
     auto bip66 = chain::script::is_enabled(program.forks(), bip66_rule);
     auto bip143 = chain::script::is_enabled(program.forks(), bip143_rule);
@@ -769,10 +776,19 @@ inline interpreter::result interpreter::op_check_multisig_verify(
             !parse_signature(signature, distinguished, bip66))
             return error::invalid_signature_encoding;
 
+        // The signature hash varies only by sighash type, so each endorsement
+        // tried against successive public keys generally reuses its hash.
         // Version condition preserves independence of bip141 and bip143.
-        if (chain::script::check_signature(signature, sighash, public_key,
-            script_code, program.transaction(), program.input_index(),
-            version, program.value()))
+        if (!hashed || *hashed != sighash)
+        {
+            signature_hash = chain::script::generate_signature_hash(
+                program.transaction(), program.input_index(), script_code,
+                sighash, version, program.value());
+            hashed = sighash;
+        }
+
+        if (chain::script::check_signature(signature, public_key,
+            signature_hash))
             ++endorsement;
     }
 
@@ -885,7 +901,7 @@ inline interpreter::result interpreter::op_check_sequence_verify(
 }
 
 // It is expected that the compiler will produce a very efficient jump table.
-inline interpreter::result interpreter::run_op(const operation& op,
+inline interpreter::result interpreter::run_op(const operation_view& op,
     program& program)
 {
     const auto code = op.code();
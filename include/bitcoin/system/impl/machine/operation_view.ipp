@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_OPERATION_VIEW_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_OPERATION_VIEW_IPP
+
+#include <cstdint>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/machine/opcode.hpp>
+#include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+inline operation_view::operation_view()
+  : operation_view(invalid_code, nullptr, 0, false)
+{
+}
+
+inline operation_view::operation_view(const operation& op)
+  : operation_view(op.code(), op.data().data(),
+        static_cast<uint32_t>(op.data().size()), op.is_valid())
+{
+}
+
+// private
+inline operation_view::operation_view(opcode code, const uint8_t* data,
+    uint32_t size, bool valid)
+  : data_(data), size_(size), code_(code), valid_(valid)
+{
+}
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+inline bool operation_view::is_valid() const
+{
+    return valid_;
+}
+
+// Serialization.
+//-----------------------------------------------------------------------------
+
+inline operation operation_view::to_operation() const
+{
+    return{ code_, to_chunk(data()), valid_ };
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+inline opcode operation_view::code() const
+{
+    return code_;
+}
+
+inline data_slice operation_view::data() const
+{
+    return{ data_, data_ + size_ };
+}
+
+// Utilities.
+//-----------------------------------------------------------------------------
+
+inline bool operation_view::is_push() const
+{
+    return operation::is_push(code_);
+}
+
+inline bool operation_view::is_counted() const
+{
+    return operation::is_counted(code_);
+}
+
+inline bool operation_view::is_disabled() const
+{
+    return operation::is_disabled(code_);
+}
+
+inline bool operation_view::is_conditional() const
+{
+    return operation::is_conditional(code_);
+}
+
+inline bool operation_view::is_oversized() const
+{
+    // bit.ly/2eSDkOJ
+    return size_ > max_push_data_size;
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
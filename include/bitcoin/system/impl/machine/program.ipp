@@ -22,12 +22,17 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <utility>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/constants.hpp>
 #include <bitcoin/system/machine/number.hpp>
+#include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/machine/operation_view.hpp>
 #include <bitcoin/system/machine/script_version.hpp>
+#include <bitcoin/system/machine/stack_element.hpp>
 #include <bitcoin/system/utility/assert.hpp>
 #include <bitcoin/system/utility/data.hpp>
 
@@ -41,7 +46,11 @@ namespace machine {
 inline bool program::is_valid() const
 {
     // Invalid operations indicates a failure deserializing individual ops.
-    return script_.is_valid_operations() && !script_.is_unspendable();
+    // This follows script::is_valid_operations and script::is_unspendable,
+    // using the decoded operations so that script operations are not parsed.
+    return (operations_.empty() || (operations_.back().is_valid() &&
+        operations_.front().code() != opcode::return_)) &&
+        script_.serialized_size(false) <= max_script_size;
 }
 
 inline uint32_t program::forks() const
@@ -74,7 +83,7 @@ inline const chain::transaction& program::transaction() const
 
 inline program::op_iterator program::begin() const
 {
-    return script_.begin();
+    return operations_.begin();
 }
 
 inline program::op_iterator program::jump() const
@@ -84,7 +93,7 @@ inline program::op_iterator program::jump() const
 
 inline program::op_iterator program::end() const
 {
-    return script_.end();
+    return operations_.end();
 }
 
 inline size_t program::operation_count() const
@@ -100,7 +109,7 @@ inline bool operation_overflow(size_t count)
     return count > max_counted_ops;
 }
 
-inline bool program::increment_operation_count(const operation& op)
+inline bool program::increment_operation_count(const operation_view& op)
 {
     // Addition is safe due to script size metadata.
     if (operation::is_counted(op.code()))
@@ -122,21 +131,22 @@ inline bool program::increment_operation_count(int32_t public_keys)
     return !operation_overflow(operation_count_);
 }
 
-inline bool program::set_jump_register(const operation& op, int32_t offset)
+inline bool program::set_jump_register(const operation_view& op,
+    int32_t offset)
 {
-    if (script_.empty())
+    if (operations_.empty())
         return false;
 
-    const auto finder = [&op](const operation& operation)
+    const auto finder = [&op](const operation_view& operation)
     {
         return &operation == &op;
     };
 
     // This is not efficient but is simplifying and subscript is rarely used.
     // Otherwise we must track the program counter through each evaluation.
-    jump_ = std::find_if(script_.begin(), script_.end(), finder);
+    jump_ = std::find_if(operations_.begin(), operations_.end(), finder);
 
-    if (jump_ == script_.end())
+    if (jump_ == operations_.end())
         return false;
 
     // This does not require guard because op_codeseparator can only increment.
@@ -172,10 +182,10 @@ inline void program::push_copy(const value_type& item)
 //-----------------------------------------------------------------------------
 
 // This must be guarded.
-inline data_chunk program::pop()
+inline program::value_type program::pop()
 {
     BITCOIN_ASSERT(!empty());
-    const auto value = primary_.back();
+    auto value = std::move(primary_.back());
     primary_.pop_back();
     return value;
 }
@@ -235,7 +245,7 @@ inline bool program::pop(data_stack& section, size_t count)
         return false;
 
     for (size_t i = 0; i < count; ++i)
-        section.push_back(pop());
+        section.push_back(to_chunk(pop()));
 
     return true;
 }
@@ -254,8 +264,8 @@ inline void program::swap(size_t index_left, size_t index_right)
 {
     // TODO: refactor to allow DRY without const_cast here.
     std::swap(
-        const_cast<data_stack::value_type&>(item(index_left)),
-        const_cast<data_stack::value_type&>(item(index_right)));
+        const_cast<value_type&>(item(index_left)),
+        const_cast<value_type&>(item(index_right)));
 }
 
 // pop1/pop2/.../pop[pos-1]/pop[pos]/push[pos-1]/.../push2/push1
@@ -315,13 +325,13 @@ inline bool program::is_stack_overflow() const
     return size() + alternate_.size() > max_stack_size;
 }
 
-inline bool program::if_(const operation& op) const
+inline bool program::if_(const operation_view& op) const
 {
     // Skip operation if failed and the operator is unconditional.
     return op.is_conditional() || succeeded();
 }
 
-inline const data_stack::value_type& program::item(size_t index) /*const*/
+inline const program::value_type& program::item(size_t index) /*const*/
 {
     return *position(index);
 }
@@ -343,8 +353,10 @@ inline operation::list program::subscript() const
 {
     operation::list ops;
 
+    ops.reserve(std::distance(jump(), end()));
+
     for (auto op = jump(); op != end(); ++op)
-        ops.push_back(*op);
+        ops.push_back(op->to_operation());
 
     return ops;
 }
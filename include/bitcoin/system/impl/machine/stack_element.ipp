@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_ELEMENT_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_STACK_ELEMENT_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/utility/assert.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+inline stack_element::stack_element()
+  : size_(0), capacity_(inline_capacity)
+{
+}
+
+inline stack_element::stack_element(stack_element&& other) BC_NOEXCEPT
+  : size_(other.size_), capacity_(other.capacity_)
+{
+    if (other.is_inline())
+    {
+        std::memcpy(local_, other.local_, size_);
+        return;
+    }
+
+    // Take the allocation, leaving the other empty and inline.
+    heap_ = other.heap_;
+    other.size_ = 0;
+    other.capacity_ = inline_capacity;
+}
+
+inline stack_element::stack_element(const stack_element& other)
+  : stack_element()
+{
+    assign(other.data(), other.size());
+}
+
+inline stack_element::stack_element(std::initializer_list<uint8_t> values)
+  : stack_element()
+{
+    assign(values.begin(), values.size());
+}
+
+inline stack_element::stack_element(const data_slice& data)
+  : stack_element()
+{
+    assign(data.data(), data.size());
+}
+
+inline stack_element::stack_element(const data_chunk& data)
+  : stack_element()
+{
+    assign(data.data(), data.size());
+}
+
+template <size_t Size>
+stack_element::stack_element(const byte_array<Size>& data)
+  : stack_element()
+{
+    assign(data.data(), data.size());
+}
+
+inline stack_element::~stack_element()
+{
+    release();
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+inline stack_element& stack_element::operator=(stack_element&& other)
+    BC_NOEXCEPT
+{
+    if (this == &other)
+        return *this;
+
+    if (other.is_inline())
+    {
+        assign(other.local_, other.size_);
+        return *this;
+    }
+
+    // Take the allocation, leaving the other empty and inline.
+    release();
+    heap_ = other.heap_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.size_ = 0;
+    other.capacity_ = inline_capacity;
+    return *this;
+}
+
+inline stack_element& stack_element::operator=(const stack_element& other)
+{
+    if (this != &other)
+        assign(other.data(), other.size());
+
+    return *this;
+}
+
+inline bool stack_element::operator==(const stack_element& other) const
+{
+    return size_ == other.size_ &&
+        (size_ == 0 || std::memcmp(data(), other.data(), size_) == 0);
+}
+
+inline bool stack_element::operator!=(const stack_element& other) const
+{
+    return !(*this == other);
+}
+
+inline uint8_t stack_element::operator[](size_t index) const
+{
+    BITCOIN_ASSERT(index < size_);
+    return data()[index];
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+inline const uint8_t* stack_element::data() const
+{
+    return is_inline() ? local_ : heap_;
+}
+
+inline stack_element::const_iterator stack_element::begin() const
+{
+    return data();
+}
+
+inline stack_element::const_iterator stack_element::end() const
+{
+    return data() + size_;
+}
+
+inline uint8_t stack_element::front() const
+{
+    BITCOIN_ASSERT(!empty());
+    return data()[0];
+}
+
+inline uint8_t stack_element::back() const
+{
+    BITCOIN_ASSERT(!empty());
+    return data()[size_ - 1];
+}
+
+inline size_t stack_element::size() const
+{
+    return size_;
+}
+
+inline bool stack_element::empty() const
+{
+    return size_ == 0;
+}
+
+inline bool stack_element::is_inline() const
+{
+    return capacity_ == inline_capacity;
+}
+
+// private
+inline uint8_t* stack_element::buffer()
+{
+    return is_inline() ? local_ : heap_;
+}
+
+// private
+inline void stack_element::assign(const uint8_t* data, size_t size)
+{
+    // Stack values are bounded by max_push_data_size, and witness elements
+    // by the transaction size, so the size cannot overflow 32 bits.
+    BITCOIN_ASSERT(size <= max_uint32);
+
+    if (size > capacity_)
+    {
+        release();
+        heap_ = new uint8_t[size];
+        capacity_ = static_cast<uint32_t>(size);
+    }
+
+    // Source and destination cannot overlap unless identical.
+    if (size != 0 && data != buffer())
+        std::memcpy(buffer(), data, size);
+
+    size_ = static_cast<uint32_t>(size);
+}
+
+// private
+inline void stack_element::release()
+{
+    if (!is_inline())
+        delete[] heap_;
+
+    size_ = 0;
+    capacity_ = inline_capacity;
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_UINT256_IPP
+#define LIBBITCOIN_SYSTEM_MATH_UINT256_IPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/assert.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Conversions.
+//-----------------------------------------------------------------------------
+
+inline uint256::uint256(const hash_digest& hash)
+  : uint256()
+{
+    static_assert(sizeof(hash_digest) == word_count * sizeof(uint64_t),
+        "unexpected hash size");
+
+    for (size_t byte = 0; byte < hash.size(); ++byte)
+        words_[byte / sizeof(uint64_t)] |= static_cast<uint64_t>(hash[byte])
+            << (8 * (byte % sizeof(uint64_t)));
+}
+
+inline uint256::uint256(const uint256_t& value)
+{
+    static const uint256_t mask(max_uint64);
+
+    for (size_t index = 0; index < word_count; ++index)
+        words_[index] = static_cast<uint64_t>(
+            (value >> (index * word_bits)) & mask);
+}
+
+inline uint256::operator uint256_t() const
+{
+    uint256_t out;
+
+    for (size_t index = word_count; index-- > 0;)
+    {
+        out <<= word_bits;
+        out |= words_[index];
+    }
+
+    return out;
+}
+
+inline uint256::operator uint64_t() const
+{
+    return words_[0];
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+inline size_t uint256::msb() const
+{
+    for (size_t index = word_count; index-- > 0;)
+    {
+        auto word = words_[index];
+
+        if (word == 0)
+            continue;
+
+        size_t bit = 0;
+        if ((word >> 32) != 0) { word >>= 32; bit += 32; }
+        if ((word >> 16) != 0) { word >>= 16; bit += 16; }
+        if ((word >> 8) != 0) { word >>= 8; bit += 8; }
+        if ((word >> 4) != 0) { word >>= 4; bit += 4; }
+        if ((word >> 2) != 0) { word >>= 2; bit += 2; }
+        if ((word >> 1) != 0) { bit += 1; }
+        return index * word_bits + bit;
+    }
+
+    return 0;
+}
+
+inline size_t uint256::bytes() const
+{
+    return is_zero() ? 0 : msb() / 8 + 1;
+}
+
+inline bool uint256::is_zero() const
+{
+    return (words_[0] | words_[1] | words_[2] | words_[3]) == 0;
+}
+
+// private
+inline void uint256::set_bit(size_t index)
+{
+    words_[index / word_bits] |= uint64_t(1) << (index % word_bits);
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+inline uint256 uint256::operator~() const
+{
+    return{ ~words_[3], ~words_[2], ~words_[1], ~words_[0] };
+}
+
+inline uint256& uint256::operator<<=(size_t shift)
+{
+    const auto words = shift / word_bits;
+    const auto bits = shift % word_bits;
+
+    // Iterate downward so that each source word is read before overwrite.
+    for (size_t index = word_count; index-- > 0;)
+    {
+        uint64_t value = 0;
+
+        if (index >= words)
+        {
+            value = words_[index - words] << bits;
+
+            if (bits != 0 && index > words)
+                value |= words_[index - words - 1] >> (word_bits - bits);
+        }
+
+        words_[index] = value;
+    }
+
+    return *this;
+}
+
+inline uint256& uint256::operator>>=(size_t shift)
+{
+    const auto words = shift / word_bits;
+    const auto bits = shift % word_bits;
+
+    // Iterate upward so that each source word is read before overwrite.
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        uint64_t value = 0;
+
+        if (words < word_count - index)
+        {
+            value = words_[index + words] >> bits;
+
+            if (bits != 0 && words < word_count - index - 1)
+                value |= words_[index + words + 1] << (word_bits - bits);
+        }
+
+        words_[index] = value;
+    }
+
+    return *this;
+}
+
+inline uint256& uint256::operator+=(const uint256& value)
+{
+    uint64_t carry = 0;
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto sum = words_[index] + value.words_[index];
+        const auto total = sum + carry;
+        carry = (sum < value.words_[index] || total < sum) ? 1 : 0;
+        words_[index] = total;
+    }
+
+    return *this;
+}
+
+inline uint256& uint256::operator-=(const uint256& value)
+{
+    uint64_t borrow = 0;
+
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto difference = words_[index] - value.words_[index];
+        const auto total = difference - borrow;
+        borrow = (difference > words_[index] || total > difference) ? 1 : 0;
+        words_[index] = total;
+    }
+
+    return *this;
+}
+
+inline uint256& uint256::operator*=(uint32_t value)
+{
+    static BC_CONSTEXPR uint64_t low_mask = 0xffffffff;
+    uint64_t carry = 0;
+
+    // Multiply by 32 bit halves so that no partial product overflows.
+    for (size_t index = 0; index < word_count; ++index)
+    {
+        const auto low = (words_[index] & low_mask) * value + carry;
+        const auto high = (words_[index] >> 32) * value + (low >> 32);
+        words_[index] = (high << 32) | (low & low_mask);
+        carry = high >> 32;
+    }
+
+    return *this;
+}
+
+inline uint256& uint256::operator/=(uint32_t value)
+{
+    static BC_CONSTEXPR uint64_t low_mask = 0xffffffff;
+    BITCOIN_ASSERT_MSG(value != 0, "division by zero");
+
+    if (value == 0)
+        return *this = uint256();
+
+    uint64_t remainder = 0;
+
+    // Divide by 32 bit halves so that each dividend fits in 64 bits.
+    for (size_t index = word_count; index-- > 0;)
+    {
+        const auto high = (remainder << 32) | (words_[index] >> 32);
+        const auto high_quotient = high / value;
+        remainder = high % value;
+
+        const auto low = (remainder << 32) | (words_[index] & low_mask);
+        const auto low_quotient = low / value;
+        remainder = low % value;
+
+        words_[index] = (high_quotient << 32) | low_quotient;
+    }
+
+    return *this;
+}
+
+inline uint256& uint256::operator/=(const uint256& value)
+{
+    BITCOIN_ASSERT_MSG(!value.is_zero(), "division by zero");
+
+    if (value.is_zero() || *this < value)
+        return *this = uint256();
+
+    // Shift-subtract over only the bits in which the quotient may be set.
+    const auto shift = msb() - value.msb();
+    auto divisor = value << shift;
+    uint256 quotient;
+
+    for (auto bit = shift + 1; bit-- > 0;)
+    {
+        if (*this >= divisor)
+        {
+            *this -= divisor;
+            quotient.set_bit(bit);
+        }
+
+        divisor >>= 1;
+    }
+
+    return *this = quotient;
+}
+
+inline bool operator==(const uint256& left, const uint256& right)
+{
+    return left.word(0) == right.word(0) && left.word(1) == right.word(1) &&
+        left.word(2) == right.word(2) && left.word(3) == right.word(3);
+}
+
+inline bool operator!=(const uint256& left, const uint256& right)
+{
+    return !(left == right);
+}
+
+inline bool operator<(const uint256& left, const uint256& right)
+{
+    for (size_t index = uint256::word_count; index-- > 0;)
+        if (left.word(index) != right.word(index))
+            return left.word(index) < right.word(index);
+
+    return false;
+}
+
+inline bool operator>(const uint256& left, const uint256& right)
+{
+    return right < left;
+}
+
+inline bool operator<=(const uint256& left, const uint256& right)
+{
+    return !(right < left);
+}
+
+inline bool operator>=(const uint256& left, const uint256& right)
+{
+    return !(left < right);
+}
+
+inline uint256 operator<<(uint256 left, size_t shift)
+{
+    return left <<= shift;
+}
+
+inline uint256 operator>>(uint256 left, size_t shift)
+{
+    return left >>= shift;
+}
+
+inline uint256 operator+(uint256 left, const uint256& right)
+{
+    return left += right;
+}
+
+inline uint256 operator-(uint256 left, const uint256& right)
+{
+    return left -= right;
+}
+
+inline uint256 operator*(uint256 left, uint32_t right)
+{
+    return left *= right;
+}
+
+inline uint256 operator/(uint256 left, uint32_t right)
+{
+    return left /= right;
+}
+
+inline uint256 operator/(uint256 left, const uint256& right)
+{
+    return left /= right;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
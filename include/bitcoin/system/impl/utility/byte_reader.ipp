@@ -0,0 +1,302 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_BYTE_READER_IPP
+#define LIBBITCOIN_SYSTEM_BYTE_READER_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/error.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+inline byte_reader::byte_reader(const data_slice& data)
+  : iterator_(data.data()), end_(data.data() + data.size()), valid_(true)
+{
+}
+
+inline size_t byte_reader::remaining() const
+{
+    return valid_ ? static_cast<size_t>(end_ - iterator_) : 0;
+}
+
+// Context.
+//-----------------------------------------------------------------------------
+
+inline byte_reader::operator bool() const
+{
+    return valid_;
+}
+
+inline bool byte_reader::operator!() const
+{
+    return !valid_;
+}
+
+inline bool byte_reader::is_exhausted() const
+{
+    return remaining() == 0;
+}
+
+inline void byte_reader::invalidate()
+{
+    valid_ = false;
+}
+
+// Hashes.
+//-----------------------------------------------------------------------------
+
+inline hash_digest byte_reader::read_hash()
+{
+    return read_forward<hash_size>();
+}
+
+inline short_hash byte_reader::read_short_hash()
+{
+    return read_forward<short_hash_size>();
+}
+
+inline mini_hash byte_reader::read_mini_hash()
+{
+    return read_forward<mini_hash_size>();
+}
+
+// Big Endian Integers.
+//-----------------------------------------------------------------------------
+
+inline uint16_t byte_reader::read_2_bytes_big_endian()
+{
+    return read_big_endian<uint16_t>();
+}
+
+inline uint32_t byte_reader::read_4_bytes_big_endian()
+{
+    return read_big_endian<uint32_t>();
+}
+
+inline uint64_t byte_reader::read_8_bytes_big_endian()
+{
+    return read_big_endian<uint64_t>();
+}
+
+inline uint64_t byte_reader::read_variable_big_endian()
+{
+    const auto value = read_byte();
+
+    switch (value)
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_big_endian();
+        case varint_four_bytes:
+            return read_4_bytes_big_endian();
+        case varint_two_bytes:
+            return read_2_bytes_big_endian();
+        default:
+            return value;
+    }
+}
+
+inline size_t byte_reader::read_size_big_endian()
+{
+    const auto size = read_variable_big_endian();
+
+    // This facilitates safely passing the size into a follow-on reader.
+    // Return zero allows follow-on use before testing reader state.
+    if (size <= max_size_t)
+        return static_cast<size_t>(size);
+
+    invalidate();
+    return 0;
+}
+
+// Little Endian Integers.
+//-----------------------------------------------------------------------------
+
+inline code byte_reader::read_error_code()
+{
+    const auto value = read_little_endian<uint32_t>();
+    return code(static_cast<error::error_code_t>(value));
+}
+
+inline uint16_t byte_reader::read_2_bytes_little_endian()
+{
+    return read_little_endian<uint16_t>();
+}
+
+inline uint32_t byte_reader::read_4_bytes_little_endian()
+{
+    return read_little_endian<uint32_t>();
+}
+
+inline uint64_t byte_reader::read_8_bytes_little_endian()
+{
+    return read_little_endian<uint64_t>();
+}
+
+inline uint64_t byte_reader::read_variable_little_endian()
+{
+    const auto value = read_byte();
+
+    switch (value)
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_little_endian();
+        case varint_four_bytes:
+            return read_4_bytes_little_endian();
+        case varint_two_bytes:
+            return read_2_bytes_little_endian();
+        default:
+            return value;
+    }
+}
+
+inline size_t byte_reader::read_size_little_endian()
+{
+    const auto size = read_variable_little_endian();
+
+    // This facilitates safely passing the size into a follow-on reader.
+    // Return zero allows follow-on use before testing reader state.
+    if (size <= max_size_t)
+        return static_cast<size_t>(size);
+
+    invalidate();
+    return 0;
+}
+
+// Bytes.
+//-----------------------------------------------------------------------------
+
+inline uint8_t byte_reader::peek_byte()
+{
+    return safe(1) ? *iterator_ : 0;
+}
+
+inline uint8_t byte_reader::read_byte()
+{
+    return safe(1) ? *iterator_++ : 0;
+}
+
+inline data_chunk byte_reader::read_bytes()
+{
+    return read_bytes(remaining());
+}
+
+// The size is checked before allocation, so an invalid size prefix cannot
+// cause allocation beyond the size of the buffer.
+inline data_chunk byte_reader::read_bytes(size_t size)
+{
+    if (!safe(size))
+        return {};
+
+    const auto begin = iterator_;
+    iterator_ += size;
+    return { begin, iterator_ };
+}
+
+inline std::string byte_reader::read_string()
+{
+    return read_string(read_size_little_endian());
+}
+
+// Removes trailing zeros, required for bitcoin string comparisons.
+inline std::string byte_reader::read_string(size_t size)
+{
+    if (!safe(size))
+        return {};
+
+    // Read up to size characters, stopping at the first null (may be many).
+    const auto begin = iterator_;
+    const auto end = std::find(begin, begin + size, string_terminator);
+    iterator_ += size;
+    return { begin, end };
+}
+
+inline void byte_reader::skip(size_t size)
+{
+    if (safe(size))
+        iterator_ += size;
+}
+
+template <size_t Size>
+byte_array<Size> byte_reader::read_forward()
+{
+    byte_array<Size> out{ {} };
+
+    if (!safe(Size))
+        return out;
+
+    std::copy_n(iterator_, Size, out.begin());
+    iterator_ += Size;
+    return out;
+}
+
+template <size_t Size>
+byte_array<Size> byte_reader::read_reverse()
+{
+    byte_array<Size> out{ {} };
+
+    if (!safe(Size))
+        return out;
+
+    std::reverse_copy(iterator_, iterator_ + Size, out.begin());
+    iterator_ += Size;
+    return out;
+}
+
+template <typename Integer>
+Integer byte_reader::read_big_endian()
+{
+    if (!safe(sizeof(Integer)))
+        return 0;
+
+    const auto begin = iterator_;
+    iterator_ += sizeof(Integer);
+    return from_big_endian_unsafe<Integer>(begin);
+}
+
+template <typename Integer>
+Integer byte_reader::read_little_endian()
+{
+    if (!safe(sizeof(Integer)))
+        return 0;
+
+    const auto begin = iterator_;
+    iterator_ += sizeof(Integer);
+    return from_little_endian_unsafe<Integer>(begin);
+}
+
+// private
+inline bool byte_reader::safe(size_t size)
+{
+    if (size > remaining())
+        invalidate();
+
+    return valid_;
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
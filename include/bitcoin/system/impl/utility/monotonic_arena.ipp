@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MONOTONIC_ARENA_IPP
+#define LIBBITCOIN_SYSTEM_MONOTONIC_ARENA_IPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace libbitcoin {
+namespace system {
+
+template <typename Type>
+arena_allocator<Type>::arena_allocator()
+{
+}
+
+template <typename Type>
+arena_allocator<Type>::arena_allocator(monotonic_arena::ptr arena)
+  : arena_(std::move(arena))
+{
+}
+
+template <typename Type>
+template <typename Other>
+arena_allocator<Type>::arena_allocator(const arena_allocator<Other>& other)
+  : arena_(other.arena())
+{
+}
+
+template <typename Type>
+Type* arena_allocator<Type>::allocate(size_t count)
+{
+    if (count > BC_MAX_SIZE / sizeof(Type))
+        throw std::bad_alloc();
+
+    const auto bytes = count * sizeof(Type);
+
+    if (!arena_)
+        return static_cast<Type*>(::operator new(bytes));
+
+    const auto alignment = std::alignment_of<Type>::value;
+    return static_cast<Type*>(arena_->allocate(bytes, alignment));
+}
+
+template <typename Type>
+void arena_allocator<Type>::deallocate(Type* pointer, size_t)
+{
+    // Arena memory is released upon destruction of the arena.
+    if (!arena_)
+        ::operator delete(pointer);
+}
+
+template <typename Type>
+arena_allocator<Type>
+arena_allocator<Type>::select_on_container_copy_construction() const
+{
+    return {};
+}
+
+template <typename Type>
+const monotonic_arena::ptr& arena_allocator<Type>::arena() const
+{
+    return arena_;
+}
+
+template <typename Left, typename Right>
+bool operator==(const arena_allocator<Left>& left,
+    const arena_allocator<Right>& right)
+{
+    return left.arena() == right.arena();
+}
+
+template <typename Left, typename Right>
+bool operator!=(const arena_allocator<Left>& left,
+    const arena_allocator<Right>& right)
+{
+    return !(left == right);
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_SHARED_WINDOW_IPP
+#define LIBBITCOIN_SYSTEM_SHARED_WINDOW_IPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <bitcoin/system/utility/assert.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// const_iterator
+// ----------------------------------------------------------------------------
+
+template <typename Type, size_t Chunk>
+shared_window<Type, Chunk>::const_iterator::const_iterator()
+  : window_(nullptr), index_(0)
+{
+}
+
+template <typename Type, size_t Chunk>
+shared_window<Type, Chunk>::const_iterator::const_iterator(
+    const shared_window* window, size_t index)
+  : window_(window), index_(index)
+{
+}
+
+template <typename Type, size_t Chunk>
+const Type& shared_window<Type, Chunk>::const_iterator::dereference() const
+{
+    return (*window_)[index_];
+}
+
+template <typename Type, size_t Chunk>
+bool shared_window<Type, Chunk>::const_iterator::equal(
+    const const_iterator& other) const
+{
+    return index_ == other.index_ && window_ == other.window_;
+}
+
+template <typename Type, size_t Chunk>
+void shared_window<Type, Chunk>::const_iterator::increment()
+{
+    ++index_;
+}
+
+template <typename Type, size_t Chunk>
+void shared_window<Type, Chunk>::const_iterator::decrement()
+{
+    --index_;
+}
+
+template <typename Type, size_t Chunk>
+void shared_window<Type, Chunk>::const_iterator::advance(
+    std::ptrdiff_t offset)
+{
+    index_ += offset;
+}
+
+template <typename Type, size_t Chunk>
+std::ptrdiff_t shared_window<Type, Chunk>::const_iterator::distance_to(
+    const const_iterator& other) const
+{
+    return static_cast<std::ptrdiff_t>(other.index_) -
+        static_cast<std::ptrdiff_t>(index_);
+}
+
+// chunk
+// ----------------------------------------------------------------------------
+
+template <typename Type, size_t Chunk>
+shared_window<Type, Chunk>::chunk::chunk()
+  : filled(0)
+{
+}
+
+// shared_window
+// ----------------------------------------------------------------------------
+
+template <typename Type, size_t Chunk>
+shared_window<Type, Chunk>::shared_window()
+  : first_(0), size_(0)
+{
+    static_assert(Chunk != 0, "chunk size must be positive");
+}
+
+template <typename Type, size_t Chunk>
+template <typename Iterator>
+shared_window<Type, Chunk>::shared_window(Iterator first, Iterator last)
+  : shared_window()
+{
+    assign(first, last);
+}
+
+template <typename Type, size_t Chunk>
+template <typename Iterator>
+void shared_window<Type, Chunk>::assign(Iterator first, Iterator last)
+{
+    clear();
+
+    for (; first != last; ++first)
+        push_back(*first);
+}
+
+template <typename Type, size_t Chunk>
+void shared_window<Type, Chunk>::push_back(const Type& value)
+{
+    const auto end = first_ + size_;
+    const auto slot = end % Chunk;
+
+    // The tail chunk is full (or there is none), so start a new chunk.
+    if (end / Chunk == chunks_.size())
+    {
+        const auto next = std::make_shared<chunk>();
+        next->values.front() = value;
+        next->filled.store(1, std::memory_order_relaxed);
+        chunks_.push_back(next);
+        ++size_;
+        return;
+    }
+
+    auto& tail = chunks_.back();
+    auto expected = slot;
+
+    // Extend the shared tail in place if no other copy has claimed the slot.
+    // Claimed slots are written only by the claimant, so this does not race
+    // reads or prefix copies of lower slots by other copies.
+    if (tail->filled.compare_exchange_strong(expected, slot + 1))
+    {
+        tail->values[slot] = value;
+        ++size_;
+        return;
+    }
+
+    // Another copy diverged at this slot, so copy the prefix and detach.
+    const auto copy = std::make_shared<chunk>();
+    std::copy_n(tail->values.begin(), slot, copy->values.begin());
+    copy->values[slot] = value;
+    copy->filled.store(slot + 1, std::memory_order_relaxed);
+    tail = copy;
+    ++size_;
+}
+
+template <typename Type, size_t Chunk>
+void shared_window<Type, Chunk>::pop_front()
+{
+    BITCOIN_ASSERT(!empty());
+    --size_;
+
+    // Release the head chunk once consumed, without disturbing any copy.
+    if (++first_ == Chunk)
+    {
+        chunks_.erase(chunks_.begin());
+        first_ = 0;
+    }
+}
+
+template <typename Type, size_t Chunk>
+void shared_window<Type, Chunk>::clear()
+{
+    chunks_.clear();
+    first_ = 0;
+    size_ = 0;
+}
+
+template <typename Type, size_t Chunk>
+size_t shared_window<Type, Chunk>::size() const
+{
+    return size_;
+}
+
+template <typename Type, size_t Chunk>
+bool shared_window<Type, Chunk>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename Type, size_t Chunk>
+const Type& shared_window<Type, Chunk>::front() const
+{
+    BITCOIN_ASSERT(!empty());
+    return (*this)[0];
+}
+
+template <typename Type, size_t Chunk>
+const Type& shared_window<Type, Chunk>::back() const
+{
+    BITCOIN_ASSERT(!empty());
+    return (*this)[size_ - 1];
+}
+
+template <typename Type, size_t Chunk>
+const Type& shared_window<Type, Chunk>::operator[](size_t index) const
+{
+    BITCOIN_ASSERT(index < size_);
+    const auto position = first_ + index;
+    return chunks_[position / Chunk]->values[position % Chunk];
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_iterator
+shared_window<Type, Chunk>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_iterator
+shared_window<Type, Chunk>::end() const
+{
+    return const_iterator(this, size_);
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_iterator
+shared_window<Type, Chunk>::cbegin() const
+{
+    return begin();
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_iterator
+shared_window<Type, Chunk>::cend() const
+{
+    return end();
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_reverse_iterator
+shared_window<Type, Chunk>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_reverse_iterator
+shared_window<Type, Chunk>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_reverse_iterator
+shared_window<Type, Chunk>::crbegin() const
+{
+    return rbegin();
+}
+
+template <typename Type, size_t Chunk>
+typename shared_window<Type, Chunk>::const_reverse_iterator
+shared_window<Type, Chunk>::crend() const
+{
+    return rend();
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
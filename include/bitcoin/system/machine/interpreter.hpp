@@ -24,6 +24,7 @@
 #include <bitcoin/system/error.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/machine/operation_view.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/utility/data.hpp>
 
@@ -43,8 +44,8 @@ public:
     static result op_disabled(opcode);
     static result op_reserved(opcode);
     static result op_push_number(program& program, uint8_t value);
-    static result op_push_size(program& program, const operation& op);
-    static result op_push_data(program& program, const data_chunk& data,
+    static result op_push_size(program& program, const operation_view& op);
+    static result op_push_data(program& program, const data_slice& data,
         uint32_t size_limit);
 
     // Operations (not shared).
@@ -103,7 +104,8 @@ public:
     static result op_sha256(program& program);
     static result op_hash160(program& program);
     static result op_hash256(program& program);
-    static result op_codeseparator(program& program, const operation& op);
+    static result op_codeseparator(program& program,
+        const operation_view& op);
     static result op_check_sig_verify(program& program);
     static result op_check_sig(program& program);
     static result op_check_multisig_verify(program& program);
@@ -119,7 +121,7 @@ public:
     static code run(const operation& op, program& program);
 
 private:
-    static result run_op(const operation& op, program& program);
+    static result run_op(const operation_view& op, program& program);
 };
 
 } // namespace machine
@@ -142,6 +142,9 @@ public:
     bool is_nominal_push() const;
 
 protected:
+    // So that operation_view may construct from its own decoding.
+    friend class operation_view;
+
     operation(opcode code, data_chunk&& data, bool valid);
     operation(opcode code, const data_chunk& data, bool valid);
     static uint32_t read_data_size(opcode code, reader& source);
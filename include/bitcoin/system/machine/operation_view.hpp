@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_OPERATION_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_OPERATION_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/machine/opcode.hpp>
+#include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// A decoded operation that references its push data in the encoded script.
+/// Decoding allocates only the list, the encoded script must outlive it.
+class BC_API operation_view
+{
+public:
+    typedef std::vector<operation_view> list;
+    typedef list::const_iterator iterator;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    operation_view();
+
+    /// The operation must outlive the view.
+    operation_view(const operation& op);
+
+    // Deserialization.
+    //-------------------------------------------------------------------------
+
+    /// Decode as script::operations, with a trailing invalid operation if a
+    /// push operation had a size mismatch.
+    static list decode(const data_slice& encoded);
+
+    bool is_valid() const;
+
+    // Serialization.
+    //-------------------------------------------------------------------------
+
+    /// Copy into an owned operation.
+    operation to_operation() const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    /// Get the op code [0..255], if is_valid is consistent with data.
+    opcode code() const;
+
+    /// Get the data, empty if not a push code or if invalid.
+    data_slice data() const;
+
+    // Utilities.
+    //-------------------------------------------------------------------------
+
+    /// Categories of operations.
+    bool is_push() const;
+    bool is_counted() const;
+    bool is_disabled() const;
+    bool is_conditional() const;
+    bool is_oversized() const;
+
+private:
+    operation_view(opcode code, const uint8_t* data, uint32_t size,
+        bool valid);
+
+    static operation_view next(const uint8_t*& position,
+        const uint8_t* end);
+
+    const uint8_t* data_;
+    uint32_t size_;
+    opcode code_;
+    bool valid_;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/operation_view.ipp>
+
+#endif
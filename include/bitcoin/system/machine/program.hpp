@@ -27,7 +27,9 @@
 #include <bitcoin/system/machine/number.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/operation.hpp>
+#include <bitcoin/system/machine/operation_view.hpp>
 #include <bitcoin/system/machine/script_version.hpp>
+#include <bitcoin/system/machine/stack_element.hpp>
 #include <bitcoin/system/utility/data.hpp>
 
 namespace libbitcoin {
@@ -37,14 +39,15 @@ namespace machine {
 class BC_API program
 {
 public:
-    typedef data_stack::value_type value_type;
-    typedef operation::iterator op_iterator;
+    typedef stack_element value_type;
+    typedef stack_element::list value_stack;
+    typedef operation_view::iterator op_iterator;
 
     // Older libstdc++ does not allow erase with const iterator.
     // This is a bug that requires we up the minimum compiler version.
     // So presently stack_iterator is a non-const iterator.
-    ////typedef data_stack::const_iterator stack_iterator;
-    typedef data_stack::iterator stack_iterator;
+    ////typedef value_stack::const_iterator stack_iterator;
+    typedef value_stack::iterator stack_iterator;
 
     /// Create an instance that does not expect to verify signatures.
     /// This is useful for script utilities but not with input metadata.
@@ -88,9 +91,9 @@ public:
     /// Instructions.
     code evaluate();
     code evaluate(const operation& op);
-    bool increment_operation_count(const operation& op);
+    bool increment_operation_count(const operation_view& op);
     bool increment_operation_count(int32_t public_keys);
-    bool set_jump_register(const operation& op, int32_t offset);
+    bool set_jump_register(const operation_view& op, int32_t offset);
 
     // Primary stack.
     //-------------------------------------------------------------------------
@@ -101,7 +104,7 @@ public:
     void push_copy(const value_type& item);
 
     /// Primary pop.
-    data_chunk pop();
+    value_type pop();
     bool pop(int32_t& out_value);
     bool pop(number& out_number, size_t maxiumum_size=max_number_size);
     bool pop_binary(number& first, number& second);
@@ -120,7 +123,7 @@ public:
     bool stack_true(bool clean) const;
     bool stack_result(bool clean) const;
     bool is_stack_overflow() const;
-    bool if_(const operation& op) const;
+    bool if_(const operation_view& op) const;
     const value_type& item(size_t index) /*const*/;
     bool top(number& out_number, size_t maxiumum_size=max_number_size) /*const*/;
     stack_iterator position(size_t index) /*const*/;
@@ -156,12 +159,15 @@ private:
     const uint32_t forks_;
     const uint64_t value_;
 
+    // Decoded once per program, referencing push data in the script.
+    const operation_view::list operations_;
+
     script_version version_;
     size_t negative_count_;
     size_t operation_count_;
     op_iterator jump_;
-    data_stack primary_;
-    data_stack alternate_;
+    value_stack primary_;
+    value_stack alternate_;
     bool_stack condition_;
 };
 
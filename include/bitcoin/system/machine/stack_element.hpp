@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_ELEMENT_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_STACK_ELEMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+#include <bitcoin/system/compat.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// A byte vector for program stacks, with inline storage for typical values
+/// (numbers, hashes, public keys and endorsements), so that these are pushed
+/// without allocation. Larger values are allocated on the heap.
+class BC_API stack_element
+{
+public:
+    typedef std::vector<stack_element> list;
+    typedef uint8_t value_type;
+    typedef const uint8_t* const_iterator;
+
+    /// Values up to this size are stored inline.
+    static BC_CONSTEXPR size_t inline_capacity = 80;
+
+    // Constructors.
+    //-------------------------------------------------------------------------
+
+    stack_element();
+    stack_element(stack_element&& other) BC_NOEXCEPT;
+    stack_element(const stack_element& other);
+    stack_element(std::initializer_list<uint8_t> values);
+    stack_element(const data_slice& data);
+    stack_element(const data_chunk& data);
+
+    template <size_t Size>
+    stack_element(const byte_array<Size>& data);
+
+    ~stack_element();
+
+    // Operators.
+    //-------------------------------------------------------------------------
+
+    stack_element& operator=(stack_element&& other) BC_NOEXCEPT;
+    stack_element& operator=(const stack_element& other);
+
+    bool operator==(const stack_element& other) const;
+    bool operator!=(const stack_element& other) const;
+
+    uint8_t operator[](size_t index) const;
+
+    // Properties.
+    //-------------------------------------------------------------------------
+
+    const uint8_t* data() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    uint8_t front() const;
+    uint8_t back() const;
+    size_t size() const;
+    bool empty() const;
+
+    /// The value is stored inline (not allocated).
+    bool is_inline() const;
+
+private:
+    uint8_t* buffer();
+    void assign(const uint8_t* data, size_t size);
+    void release();
+
+    uint32_t size_;
+    uint32_t capacity_;
+
+    union
+    {
+        uint8_t* heap_;
+        uint8_t local_[inline_capacity];
+    };
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/stack_element.ipp>
+
+#endif
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_ELLIPTIC_CURVE_HPP
 
 #include <cstddef>
+#include <vector>
 #include <bitcoin/system/compat.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/hash.hpp>
@@ -28,6 +29,8 @@
 namespace libbitcoin {
 namespace system {
 
+class threadpool;
+
 /// The sign byte value for an even (y-valued) key.
 static BC_CONSTEXPR uint8_t ec_even_sign = 2;
 
@@ -190,6 +193,29 @@ BC_API bool verify_signature(const ec_uncompressed& point,
 BC_API bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature);
 
+// Batch verify
+// ----------------------------------------------------------------------------
+
+/// A potential point (serialized public key) with a hash and signature.
+struct BC_API signature_verification
+{
+    typedef std::vector<signature_verification> list;
+
+    data_chunk point;
+    hash_digest hash;
+    ec_signature signature;
+};
+
+/// Verify a batch of EC signatures, parsing each distinct point once.
+/// The result of each verification is returned in the order of the batch.
+BC_API std::vector<bool> verify_signatures(
+    const signature_verification::list& batch);
+
+/// Verify a batch of EC signatures on the calling thread and the pool.
+/// The result of each verification is returned in the order of the batch.
+BC_API std::vector<bool> verify_signatures(
+    const signature_verification::list& batch, threadpool& pool);
+
 // Recoverable sign/recover
 // ----------------------------------------------------------------------------
 
@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_HPP
 #define LIBBITCOIN_SYSTEM_HASH_HPP
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <boost/functional/hash_fwd.hpp>
@@ -56,6 +58,18 @@ typedef std::vector<long_hash> long_hash_list;
 typedef std::vector<short_hash> short_hash_list;
 typedef std::vector<mini_hash> mini_hash_list;
 
+/// SHA256 chaining state, a midstate when taken at a block boundary.
+typedef std::array<uint32_t, 8> sha256_state;
+
+/// SHA256 compression function implementations.
+enum class sha256_backend
+{
+    portable,
+    sse41,
+    avx2,
+    shani
+};
+
 // Alias for boost big integer type.
 typedef boost::multiprecision::uint256_t uint256_t;
 
@@ -125,6 +139,14 @@ BC_API data_chunk scrypt(const data_slice& data, const data_slice& salt, uint64_
 /// Generate a bitcoin hash.
 BC_API hash_digest bitcoin_hash(const data_slice& data);
 
+/// Generate a bitcoin hash of each message, in parallel lanes where the
+/// processor supports it (such as for the transactions of a block).
+BC_API hash_list bitcoin_hash_batch(const std::vector<data_slice>& data);
+
+/// Generate a bitcoin hash of each consecutive pair of hashes, in parallel
+/// lanes where supported (a merkle tree level), the hash count must be even.
+BC_API hash_list bitcoin_hash_pairs(const hash_list& hashes);
+
 /// Generate a scrypt hash.
 BC_API hash_digest scrypt_hash(const data_slice& data);
 
@@ -147,6 +169,28 @@ BC_API data_chunk sha256_hash_chunk(const data_slice& data);
 /// This hash function was used in electrum seed stretching (obsoleted).
 BC_API hash_digest sha256_hash(const data_slice& first, const data_slice& second);
 
+/// Generate a sha256 midstate, the data size must be a multiple of 64 bytes.
+BC_API sha256_state sha256_midstate(const data_slice& blocks);
+
+/// Advance a sha256 midstate, the data size must be a multiple of 64 bytes.
+BC_API sha256_state sha256_midstate(const sha256_state& midstate,
+    const data_slice& blocks);
+
+/// Generate a sha256 hash of data that follows the given number of 64 byte
+/// blocks, from which the midstate was generated (a common prefix).
+BC_API hash_digest sha256_hash(const sha256_state& midstate, size_t blocks,
+    const data_slice& data);
+
+/// True if the sha256 backend is built in and supported by this processor.
+BC_API bool sha256_available(sha256_backend backend);
+
+/// The sha256 backend used by all sha256-based functions, the fastest
+/// available backend is selected at startup.
+BC_API sha256_backend get_sha256_backend();
+
+/// Set the sha256 backend, false if not available (not thread safe).
+BC_API bool set_sha256_backend(sha256_backend backend);
+
 // Generate a hmac sha256 hash.
 BC_API hash_digest hmac_sha256_hash(const data_slice& data, const data_slice& key);
 
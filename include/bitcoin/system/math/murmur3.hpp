@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MURMUR3_HPP
+#define LIBBITCOIN_SYSTEM_MURMUR3_HPP
+
+#include <cstdint>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Generate a MurmurHash3 (x86, 32 bit) hash, as used by BIP37 filters.
+BC_API uint32_t murmur3(const data_slice& data, uint32_t seed);
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
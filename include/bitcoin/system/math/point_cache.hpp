@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_POINT_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_POINT_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/elliptic_curve.hpp>
+#include <bitcoin/system/math/siphash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/noncopyable.hpp>
+#include <bitcoin/system/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/**
+ * This class is thread safe.
+ * A bounded cache of parsed public keys, keyed on the serialized point, so
+ * that repeated keys are not decompressed and validated on each use. Only
+ * valid points are cached. Entries are evicted on collision. Lookups are
+ * lock-striped, so contention is limited to a fraction of the cache.
+ */
+class BC_API point_cache
+  : noncopyable
+{
+public:
+    /// The internal (parsed) representation of a point, opaque to callers.
+    static BC_CONSTEXPR size_t parsed_point_size = 64;
+    typedef byte_array<parsed_point_size> parsed_point;
+
+    /// The default number of entries (130 bytes each).
+    static const size_t default_capacity;
+
+    /// The cache consulted and filled by the elliptic curve functions.
+    /// This is allocated on first use and may be resized (zero disables).
+    static point_cache& global();
+
+    /// Construct a cache with a random index key.
+    point_cache(size_t capacity=default_capacity);
+
+    /// Populate the parsed point if the serialized point is cached.
+    bool find(parsed_point& out, const data_slice& point) const;
+
+    /// Record the parsed representation of a valid serialized point.
+    void insert(const data_slice& point, const parsed_point& parsed);
+
+    /// Change the number of entries, clearing the cache.
+    void resize(size_t capacity);
+
+    /// Remove all entries (does not reset counters).
+    void clear();
+
+    /// The number of entries.
+    size_t capacity() const;
+
+    /// Lookup counters, since construction.
+    size_t hits() const;
+    size_t misses() const;
+
+private:
+    struct entry
+    {
+        uint8_t size;
+        ec_uncompressed point;
+        parsed_point parsed;
+    };
+
+    struct stripe
+    {
+        mutable shared_mutex mutex;
+        std::vector<entry> entries;
+    };
+
+    static const size_t stripe_count;
+
+    bool cacheable(const data_slice& point) const;
+    uint64_t to_index(const data_slice& point) const;
+
+    const siphash_key key_;
+    std::vector<stripe> stripes_;
+    std::atomic<size_t> capacity_;
+    mutable std::atomic<size_t> hits_;
+    mutable std::atomic<size_t> misses_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_SIGNATURE_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_SIGNATURE_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/elliptic_curve.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/noncopyable.hpp>
+#include <bitcoin/system/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/**
+ * This class is thread safe.
+ * A bounded cache of verified signatures, keyed on a salted hash of the
+ * signature hash, public key and signature. Only successful verifications
+ * are cached, so a hit implies validity. Entries are evicted on collision.
+ * Lookups are lock-striped, so contention is limited to a fraction of the
+ * cache, and resizing locks each stripe in turn.
+ */
+class BC_API signature_cache
+  : noncopyable
+{
+public:
+    /// The default number of entries (32 bytes each).
+    static const size_t default_capacity;
+
+    /// The cache consulted and filled by script::check_signature.
+    /// This is allocated on first use and may be resized (zero disables).
+    static signature_cache& global();
+
+    /// Construct a cache with a random salt.
+    signature_cache(size_t capacity=default_capacity);
+
+    /// True if the signature has been verified against the key and hash.
+    bool contains(const hash_digest& sighash, const data_slice& public_key,
+        const ec_signature& signature) const;
+
+    /// Record the signature as verified against the key and hash.
+    void insert(const hash_digest& sighash, const data_slice& public_key,
+        const ec_signature& signature);
+
+    /// Change the number of entries, clearing the cache.
+    void resize(size_t capacity);
+
+    /// Remove all entries (does not reset counters).
+    void clear();
+
+    /// The number of entries.
+    size_t capacity() const;
+
+    /// Lookup counters, since construction.
+    size_t hits() const;
+    size_t misses() const;
+
+private:
+    struct stripe
+    {
+        mutable shared_mutex mutex;
+        std::vector<hash_digest> entries;
+    };
+
+    static const size_t stripe_count;
+
+    hash_digest to_key(const hash_digest& sighash,
+        const data_slice& public_key, const ec_signature& signature) const;
+
+    const hash_digest salt_;
+    std::vector<stripe> stripes_;
+    std::atomic<size_t> capacity_;
+    mutable std::atomic<size_t> hits_;
+    mutable std::atomic<size_t> misses_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
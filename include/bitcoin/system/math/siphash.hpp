@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_SIPHASH_HPP
+#define LIBBITCOIN_SYSTEM_SIPHASH_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A SipHash key as two little-endian 64 bit words (k0, k1).
+typedef std::array<uint64_t, 2> siphash_key;
+
+/// Read a SipHash key from 16 bytes.
+BC_API siphash_key to_siphash_key(const half_hash& key);
+
+/// Generate a SipHash-2-4 hash.
+BC_API uint64_t siphash(const siphash_key& key, const data_slice& message);
+
+/// Generate a SipHash-2-4 hash of a 32 byte message, such as a txid.
+BC_API uint64_t siphash(const siphash_key& key, const hash_digest& hash);
+
+/// Generate a SipHash-2-4 hash of each 32 byte message under one key. The
+/// messages are hashed in interleaved lanes, which the compiler may vectorize.
+BC_API std::vector<uint64_t> siphash(const siphash_key& key,
+    const hash_list& hashes);
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
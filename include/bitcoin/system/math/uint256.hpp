@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_UINT256_HPP
+#define LIBBITCOIN_SYSTEM_MATH_UINT256_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system/compat.hpp>
+#include <bitcoin/system/math/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A fixed width unsigned 256 bit integer, for proof of work targets and
+/// chain work. Words are held by value, so there is no allocation or dispatch.
+/// Arithmetic wraps modulo 2^256, as does uint256_t, and results match it.
+class uint256
+{
+public:
+    static BC_CONSTEXPR size_t word_count = 4;
+    static BC_CONSTEXPR size_t word_bits = 64;
+
+    BC_CONSTCTOR uint256()
+      : words_{ 0, 0, 0, 0 }
+    {
+    }
+
+    BC_CONSTCTOR uint256(uint64_t value)
+      : words_{ value, 0, 0, 0 }
+    {
+    }
+
+    /// Construct from words ordered from most to least significant.
+    BC_CONSTCTOR uint256(uint64_t word3, uint64_t word2, uint64_t word1,
+        uint64_t word0)
+      : words_{ word0, word1, word2, word3 }
+    {
+    }
+
+    /// Construct from a hash interpreted as a little-endian number.
+    explicit uint256(const hash_digest& hash);
+
+    /// Construct from the equivalent multiprecision value.
+    explicit uint256(const uint256_t& value);
+
+    /// The equivalent multiprecision value.
+    explicit operator uint256_t() const;
+
+    /// The low 64 bits (truncating).
+    explicit operator uint64_t() const;
+
+    /// The word at the index, from least significant (zero).
+    BC_CONSTFUNC uint64_t word(size_t index) const
+    {
+        return words_[index];
+    }
+
+    /// The index of the most significant set bit, zero if the value is zero.
+    size_t msb() const;
+
+    /// The number of bytes required to represent the value.
+    size_t bytes() const;
+
+    bool is_zero() const;
+
+    uint256 operator~() const;
+    uint256& operator<<=(size_t shift);
+    uint256& operator>>=(size_t shift);
+    uint256& operator+=(const uint256& value);
+    uint256& operator-=(const uint256& value);
+    uint256& operator*=(uint32_t value);
+    uint256& operator/=(uint32_t value);
+
+    /// Division by zero asserts and produces zero.
+    uint256& operator/=(const uint256& value);
+
+private:
+    void set_bit(size_t index);
+
+    // Words are ordered from least significant.
+    uint64_t words_[word_count];
+};
+
+inline bool operator==(const uint256& left, const uint256& right);
+inline bool operator!=(const uint256& left, const uint256& right);
+inline bool operator<(const uint256& left, const uint256& right);
+inline bool operator>(const uint256& left, const uint256& right);
+inline bool operator<=(const uint256& left, const uint256& right);
+inline bool operator>=(const uint256& left, const uint256& right);
+
+inline uint256 operator<<(uint256 left, size_t shift);
+inline uint256 operator>>(uint256 left, size_t shift);
+inline uint256 operator+(uint256 left, const uint256& right);
+inline uint256 operator-(uint256 left, const uint256& right);
+inline uint256 operator*(uint256 left, uint32_t right);
+inline uint256 operator/(uint256 left, uint32_t right);
+inline uint256 operator/(uint256 left, const uint256& right);
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/math/uint256.ipp>
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MESSAGE_BLOOM_FILTER_HPP
+#define LIBBITCOIN_SYSTEM_MESSAGE_BLOOM_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/message/filter_add.hpp>
+#include <bitcoin/system/message/filter_load.hpp>
+#include <bitcoin/system/utility/data.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace message {
+
+/// A BIP37 connection bloom filter, as loaded by filter_load and extended by
+/// filter_add. Element bits are selected by murmur3 under the tweak.
+class BC_API bloom_filter
+{
+public:
+    /// The outpoint insertion behavior when an output script matches.
+    enum update : uint8_t
+    {
+        /// Never insert matched outpoints.
+        none = 0,
+
+        /// Insert the outpoint of each output with a matched script.
+        all = 1,
+
+        /// Insert the outpoint only if the output is pay to public key or
+        /// bare multisig.
+        p2pubkey_only = 2,
+
+        /// The flags bits that select the update behavior, others are ignored.
+        mask = 3
+    };
+
+    /// A filter of no bits, which matches everything.
+    bloom_filter();
+
+    /// Size the filter and hash function count for the expected element count
+    /// and false positive rate, limited by the protocol maximums.
+    bloom_filter(size_t elements, double false_positive_rate, uint32_t tweak,
+        uint8_t flags);
+
+    /// Use the filter loaded by the peer.
+    bloom_filter(const filter_load& load);
+    bloom_filter(filter_load&& load);
+
+    /// False if the filter size or hash function count exceeds the maximum.
+    bool is_valid() const;
+
+    const data_chunk& filter() const;
+    uint32_t hash_functions() const;
+    uint32_t tweak() const;
+    uint8_t flags() const;
+
+    /// The filter_load message for this filter.
+    filter_load to_filter_load() const;
+
+    /// Insert an element or an outpoint.
+    void insert(const data_slice& element);
+    void insert(const chain::point& point);
+
+    /// Insert the element of a filter_add, false if it exceeds the maximum.
+    bool add(const filter_add& message);
+
+    /// True if the element may be in the set, false if it is not.
+    bool contains(const data_slice& element) const;
+    bool contains(const chain::point& point) const;
+
+    /// True if the transaction hash, an output script push, a previous output
+    /// or an input script push matches. Outpoints of matched outputs are
+    /// inserted as directed by the update flags, so that spends of them match.
+    bool match(const chain::transaction& tx);
+
+    /// Match each transaction of the block in order, for merkle_block.
+    std::vector<bool> match(const chain::block& block);
+
+private:
+    uint32_t bit(uint32_t hash_number, const data_slice& element) const;
+    bool match_outputs(const chain::transaction& tx);
+    bool match_inputs(const chain::transaction& tx) const;
+
+    data_chunk filter_;
+    uint32_t hash_functions_;
+    uint32_t tweak_;
+    uint8_t flags_;
+};
+
+} // namespace message
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -21,7 +21,10 @@
 
 #include <istream>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/chain/block.hpp>
 #include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/siphash.hpp>
 #include <bitcoin/system/message/prefilled_transaction.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
@@ -54,6 +57,11 @@ public:
     compact_block(const compact_block& other);
     compact_block(compact_block&& other);
 
+    /// Construct from a block, prefilling the coinbase (BIP152). Short ids
+    /// are of witness hashes if witness is set (compact block version 2).
+    compact_block(const chain::block& block, uint64_t nonce,
+        bool witness=false);
+
     chain::header& header();
     const chain::header& header() const;
     void set_header(const chain::header& value);
@@ -72,6 +80,13 @@ public:
     void set_transactions(const prefilled_transaction::list& value);
     void set_transactions(prefilled_transaction::list&& value);
 
+    /// The SipHash key of the short ids, from the header and nonce.
+    siphash_key short_id_key() const;
+
+    /// The short id of each transaction hash under the SipHash key.
+    static short_id_list to_short_ids(const siphash_key& key,
+        const hash_list& hashes);
+
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
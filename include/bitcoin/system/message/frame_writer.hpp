@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MESSAGE_FRAME_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_MESSAGE_FRAME_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace message {
+
+/// A serialized message heading (magic, command, payload size, checksum).
+typedef byte_array<sizeof(uint32_t) + command_size + sizeof(uint32_t) +
+    sizeof(uint32_t)> heading_bytes;
+
+/// The heading for a payload that is already serialized, such as the buffer
+/// of a block view. The heading and payload may then be sent together as
+/// separate buffers (scatter/gather), without copying the payload.
+BC_API heading_bytes frame_heading(uint32_t magic, const std::string& command,
+    const data_slice& payload);
+
+/// A writer of a wire message payload into a caller-owned (possibly pooled)
+/// buffer, after space for the heading. The payload checksum is computed as
+/// the payload is written and the heading is then written in place, so the
+/// message is framed in a single pass without copying.
+class BC_API frame_writer
+  : public sha256_writer
+{
+public:
+    /// Size the buffer for the heading and the payload, retaining capacity.
+    frame_writer(data_chunk& buffer, size_t payload_size);
+
+    /// Write the heading in place, false if the payload written is not of
+    /// the size given on construction.
+    bool finish(uint32_t magic, const std::string& command);
+
+    /// Context, false if writing would exceed the payload size.
+    operator bool() const;
+    bool operator!() const;
+
+    /// Write required size buffer, to the payload and its checksum.
+    using sha256_writer::write_bytes;
+    void write_bytes(const uint8_t* data, size_t size);
+
+private:
+    data_chunk& buffer_;
+    size_t position_;
+    bool valid_;
+};
+
+} // namespace message
+} // namespace system
+} // namespace libbitcoin
+
+#endif
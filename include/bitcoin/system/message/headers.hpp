@@ -24,17 +24,23 @@
 #include <istream>
 #include <memory>
 #include <string>
+#include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/message/header.hpp>
 #include <bitcoin/system/message/inventory.hpp>
 #include <bitcoin/system/message/inventory_vector.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/reader.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
 #include <bitcoin/system/utility/writer.hpp>
 
 namespace libbitcoin {
 namespace system {
+
+class settings;
+
 namespace message {
 
 class BC_API headers
@@ -64,6 +70,22 @@ public:
     void to_inventory(inventory_vector::list& out,
         inventory::type_id type) const;
 
+    /// Hash all headers in parallel lanes, caching each header's hash.
+    void cache_hashes() const;
+
+    /// Check each header, then verify that the headers are sequential.
+    code check(uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+        bool scrypt=false) const;
+
+    /// Check proof of work and timestamps concurrently on the pool.
+    code check(uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+        threadpool& pool, bool scrypt=false) const;
+
+    /// Accept headers in order above the parent state, populating the chain
+    /// state of each header's metadata, stopping at the first failure.
+    code accept(const chain::chain_state& parent,
+        const system::settings& settings) const;
+
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
@@ -88,8 +88,9 @@ public:
     uint32_t magic() const;
     void set_magic(uint32_t value);
 
-    std::string& command();
-    const std::string& command() const;
+    /// The command is held as its fixed size, null padded wire form, so a
+    /// longer command is truncated to command_size characters.
+    std::string command() const;
     void set_command(const std::string& value);
     void set_command(std::string&& value);
 
@@ -99,6 +100,7 @@ public:
     uint32_t checksum() const;
     void set_checksum(uint32_t value);
 
+    /// The message type of the command, in constant time.
     message_type type() const;
 
     bool from_data(const data_chunk& data);
@@ -118,8 +120,13 @@ public:
     bool operator!=(const heading& other) const;
 
 private:
+    typedef byte_array<command_size> command_bytes;
+
+    static command_bytes to_command(const std::string& value);
+    static void terminate(command_bytes& command);
+
     uint32_t magic_;
-    std::string command_;
+    command_bytes command_;
     uint32_t payload_size_;
     uint32_t checksum_;
 };
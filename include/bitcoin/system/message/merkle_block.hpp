@@ -19,9 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_MESSAGE_MERKLE_BLOCK_HPP
 #define LIBBITCOIN_SYSTEM_MESSAGE_MERKLE_BLOCK_HPP
 
+#include <cstddef>
 #include <istream>
 #include <memory>
 #include <string>
+#include <vector>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/chain/block.hpp>
 #include <bitcoin/system/chain/header.hpp>
@@ -50,6 +52,10 @@ public:
     merkle_block(chain::header&& header, size_t total_transactions,
         hash_list&& hashes, data_chunk&& flags);
     merkle_block(const chain::block& block);
+
+    /// Build the partial merkle tree (BIP37) of the matched transactions of
+    /// the block, with one match value for each transaction in block order.
+    merkle_block(const chain::block& block, const std::vector<bool>& matches);
     merkle_block(const merkle_block& other);
     merkle_block(merkle_block&& other);
 
@@ -71,6 +77,13 @@ public:
     void set_flags(const data_chunk& value);
     void set_flags(data_chunk&& value);
 
+    /// Verify the partial merkle tree against the header merkle root and obtain
+    /// the matched transaction hashes with their positions in the block. False
+    /// if the tree is malformed, has unused hashes or flag bytes, or contains
+    /// a duplicated subtree (CVE-2012-2459) or if the root does not match.
+    bool extract_matches(hash_list& out_hashes,
+        std::vector<size_t>& out_indexes) const;
+
     bool from_data(uint32_t version, const data_chunk& data);
     bool from_data(uint32_t version, std::istream& stream);
     bool from_data(uint32_t version, reader& source);
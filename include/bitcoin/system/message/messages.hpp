@@ -33,6 +33,7 @@
 #include <bitcoin/system/message/filter_add.hpp>
 #include <bitcoin/system/message/filter_clear.hpp>
 #include <bitcoin/system/message/filter_load.hpp>
+#include <bitcoin/system/message/frame_writer.hpp>
 #include <bitcoin/system/message/get_address.hpp>
 #include <bitcoin/system/message/get_block_transactions.hpp>
 #include <bitcoin/system/message/get_blocks.hpp>
@@ -54,6 +55,7 @@
 #include <bitcoin/system/message/transaction.hpp>
 #include <bitcoin/system/message/verack.hpp>
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/assert.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/data.hpp>
 
@@ -148,43 +150,26 @@ DECLARE_MESSAGE_POINTER_LIST_POINTER_TYPES(transaction);
 
 namespace message {
 
+/// Serialize a message object to the Bitcoin wire protocol encoding, into a
+/// caller-owned (possibly pooled) buffer, which is resized to the message.
+template <typename Message>
+void serialize(data_chunk& out, uint32_t version, const Message& packet,
+    uint32_t magic)
+{
+    // The payload is written and hashed in one pass, after the heading space.
+    frame_writer sink(out, packet.serialized_size(version));
+    packet.to_data(version, sink);
+    DEBUG_ONLY(const auto framed =) sink.finish(magic, Message::command);
+    BITCOIN_ASSERT(framed);
+}
+
 /// Serialize a message object to the Bitcoin wire protocol encoding.
 template <typename Message>
 data_chunk serialize(uint32_t version, const Message& packet,
     uint32_t magic)
 {
-    const auto heading_size = heading::satoshi_fixed_size();
-    const auto payload_size = packet.serialized_size(version);
-    const auto message_size = heading_size + payload_size;
-
-    // Unfortunately data_sink doesn't support seek, so this is a little ugly.
-    // The header requires payload size and checksum but prepends the payload.
-    // Use a stream to prevent unnecessary copying of the payload.
     data_chunk data;
-
-    // Reserve memory for the full message.
-    data.reserve(message_size);
-
-    // Size the vector for the heading so that payload insertion will follow.
-    data.resize(heading_size);
-
-    // Insert the payload after the heading and into the reservation.
-    data_sink ostream(data);
-    packet.to_data(version, ostream);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == message_size);
-
-    // Create the payload checksum without copying the buffer.
-    const data_slice slice(data.data() + heading_size, data.data() + message_size);
-    const auto check = bitcoin_checksum(slice);
-    const auto payload_size32 = safe_unsigned<uint32_t>(payload_size);
-
-    // Create and serialize the heading to a temporary variable (12 bytes).
-    heading head(magic, Message::command, payload_size32, check);
-    auto heading = head.to_data();
-
-    // Move the heading into the allocated beginning of the message buffer.
-    std::move(heading.begin(), heading.end(), data.begin());
+    serialize(data, version, packet, magic);
     return data;
 }
 
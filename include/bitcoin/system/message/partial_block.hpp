@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MESSAGE_PARTIAL_BLOCK_HPP
+#define LIBBITCOIN_SYSTEM_MESSAGE_PARTIAL_BLOCK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/math/siphash.hpp>
+#include <bitcoin/system/message/block_transactions.hpp>
+#include <bitcoin/system/message/compact_block.hpp>
+#include <bitcoin/system/message/get_block_transactions.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace message {
+
+/// A block under reconstruction from a compact block (BIP152). Prefilled and
+/// requested transaction indexes are differentially encoded, as on the wire.
+class BC_API partial_block
+{
+public:
+    /// Index the short ids of the compact block, which are of witness hashes
+    /// if witness is set (compact block version 2).
+    partial_block(const compact_block& block, bool witness=false);
+
+    /// False if the compact block has invalid prefilled indexes or its short
+    /// ids collide, in which case the full block should be requested.
+    bool is_valid() const;
+
+    /// True if all transactions of the block are filled.
+    bool is_complete() const;
+
+    /// Fill transactions by short id from candidates, such as a memory pool.
+    /// A short id matched by distinct candidates remains missing.
+    void fill(const chain::transaction::list& candidates);
+
+    /// Fill the missing transactions from the response to a missing request,
+    /// false if the response is for another block or of the wrong count.
+    bool fill(const block_transactions& response);
+
+    /// The request for all transactions not yet filled.
+    get_block_transactions missing() const;
+
+    /// Assemble the filled block, false if incomplete or if the merkle root
+    /// does not match (a short id collision with a candidate), in which case
+    /// the full block should be requested.
+    bool to_block(chain::block& out) const;
+
+private:
+    enum class state : uint8_t
+    {
+        missing,
+        filled,
+        ambiguous
+    };
+
+    chain::header header_;
+    siphash_key key_;
+    bool witness_;
+    bool valid_;
+    size_t missing_;
+    chain::transaction::list transactions_;
+    std::vector<state> states_;
+    std::unordered_map<uint64_t, size_t> slots_;
+};
+
+} // namespace message
+} // namespace system
+} // namespace libbitcoin
+
+#endif
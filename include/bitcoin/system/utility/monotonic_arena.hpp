@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MONOTONIC_ARENA_HPP
+#define LIBBITCOIN_SYSTEM_MONOTONIC_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <bitcoin/system/compat.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/utility/noncopyable.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/**
+ * A monotonic allocation resource, not thread safe.
+ * Allocations are carved from a small number of large blocks and are only
+ * released, all at once, upon destruction of the arena.
+ */
+class BC_API monotonic_arena
+  : noncopyable
+{
+public:
+    typedef std::shared_ptr<monotonic_arena> ptr;
+
+    /// The default alignment suffices for any scalar type.
+    static const size_t default_alignment;
+
+    /// The first block is allocated on first use, subsequent blocks double.
+    monotonic_arena(size_t initial_capacity=4096);
+
+    /// Allocate from the current block, or from a new block if exhausted.
+    void* allocate(size_t bytes, size_t alignment=default_alignment);
+
+    /// The number of blocks allocated.
+    size_t blocks() const;
+
+    /// The total number of bytes allocated from blocks.
+    size_t capacity() const;
+
+    /// The number of bytes allocated from the arena (including padding).
+    size_t size() const;
+
+private:
+    typedef std::unique_ptr<uint8_t[]> block;
+
+    void grow(size_t minimum);
+
+    size_t next_capacity_;
+    size_t capacity_;
+    size_t size_;
+    uint8_t* position_;
+    uint8_t* end_;
+    std::vector<block> blocks_;
+};
+
+/**
+ * A standard allocator over a shared monotonic arena.
+ * Deallocation is deferred to destruction of the arena, which is retained
+ * by each allocator. Without an arena the allocator uses the free store.
+ * Copy construction selects the free store, but copy assignment retains the
+ * target's allocator (and so its arena), so an owner that must confine its
+ * arena to one thread replaces its containers on copy assignment.
+ */
+template <typename Type>
+class arena_allocator
+{
+public:
+    typedef Type value_type;
+
+    /// Moved and swapped containers retain their arena.
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template <typename Other>
+    struct rebind
+    {
+        typedef arena_allocator<Other> other;
+    };
+
+    arena_allocator();
+    arena_allocator(monotonic_arena::ptr arena);
+
+    template <typename Other>
+    arena_allocator(const arena_allocator<Other>& other);
+
+    Type* allocate(size_t count);
+    void deallocate(Type* pointer, size_t count);
+
+    /// Copies of containers are allocated from the free store.
+    arena_allocator select_on_container_copy_construction() const;
+
+    const monotonic_arena::ptr& arena() const;
+
+private:
+    monotonic_arena::ptr arena_;
+};
+
+template <typename Left, typename Right>
+bool operator==(const arena_allocator<Left>& left,
+    const arena_allocator<Right>& right);
+
+template <typename Left, typename Right>
+bool operator!=(const arena_allocator<Left>& left,
+    const arena_allocator<Right>& right);
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/utility/monotonic_arena.ipp>
+
+#endif
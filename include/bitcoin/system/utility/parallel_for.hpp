@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_PARALLEL_FOR_HPP
+#define LIBBITCOIN_SYSTEM_PARALLEL_FOR_HPP
+
+#include <cstddef>
+#include <functional>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Invoke work once for each index in [0, count), concurrently on the calling
+/// thread and on up to one fewer than count pool threads. Indexes are claimed
+/// in ascending order, and once work fails no subsequent index is claimed.
+/// Returns when all claimed work is complete, with the code of the lowest
+/// failing index, or success. Work is not invoked after return.
+BC_API code parallel_for(threadpool& pool, size_t count,
+    std::function<code(size_t)> work);
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_SHA256_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_SHA256_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/writer.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A writer that hashes its input incrementally, so that the serialization
+/// of an object may be hashed without being materialized.
+class BC_API sha256_writer
+  : public writer
+{
+public:
+    /// Start hashing from the sha256 initial state.
+    sha256_writer();
+
+    /// Start hashing after the given number of 64 byte blocks, from which the
+    /// midstate was generated (a common prefix).
+    sha256_writer(const sha256_state& midstate, size_t blocks);
+
+    template <size_t Size>
+    void write_forward(const byte_array<Size>& value);
+
+    template <size_t Size>
+    void write_reverse(const byte_array<Size>& value);
+
+    template <typename Integer>
+    void write_big_endian(Integer value);
+
+    template <typename Integer>
+    void write_little_endian(Integer value);
+
+    /// The sha256 hash of all bytes written (does not reset the writer).
+    hash_digest sha256_digest() const;
+
+    /// The double sha256 hash of all bytes written (does not reset the writer).
+    hash_digest bitcoin_digest() const;
+
+    /// The number of bytes written, including any prefix blocks.
+    uint64_t size() const;
+
+    /// Context.
+    operator bool() const;
+    bool operator!() const;
+
+    /// Write hashes.
+    void write_hash(const hash_digest& value);
+    void write_short_hash(const short_hash& value);
+    void write_mini_hash(const mini_hash& value);
+
+    /// Write big endian integers.
+    void write_2_bytes_big_endian(uint16_t value);
+    void write_4_bytes_big_endian(uint32_t value);
+    void write_8_bytes_big_endian(uint64_t value);
+    void write_variable_big_endian(uint64_t value);
+    void write_size_big_endian(size_t value);
+
+    /// Write little endian integers.
+    void write_error_code(const code& ec);
+    void write_2_bytes_little_endian(uint16_t value);
+    void write_4_bytes_little_endian(uint32_t value);
+    void write_8_bytes_little_endian(uint64_t value);
+    void write_variable_little_endian(uint64_t value);
+    void write_size_little_endian(size_t value);
+
+    /// Write one byte.
+    void write_byte(uint8_t value);
+
+    /// Write all bytes.
+    void write_bytes(const data_slice& data);
+
+    /// Write required size buffer.
+    void write_bytes(const uint8_t* data, size_t size);
+
+    /// Write variable length string.
+    void write_string(const std::string& value, size_t size);
+
+    /// Write required length string, padded with nulls.
+    void write_string(const std::string& value);
+
+    /// Skipped bytes are hashed as nulls, there is nothing to advance over.
+    void skip(size_t size);
+
+private:
+    static BC_CONSTEXPR size_t block_size = 64;
+
+    sha256_state state_;
+    uint64_t blocks_;
+    size_t pending_;
+    byte_array<block_size> buffer_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/utility/sha256_writer.ipp>
+
+#endif
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_SHARED_WINDOW_HPP
+#define LIBBITCOIN_SYSTEM_SHARED_WINDOW_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A persistent sliding window, appended at the back and trimmed at the front.
+/// Copies share fixed-size chunks of values, so copying a window costs one
+/// pointer per chunk and an append copies at most one chunk. An append
+/// extends a shared chunk in place if no other copy has already extended it,
+/// otherwise the chunk prefix is copied. Retained values are never modified,
+/// so distinct copies may be read and appended on independent threads.
+template <typename Type, size_t Chunk = 64>
+class shared_window
+{
+public:
+    typedef Type value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Type& reference;
+    typedef const Type& const_reference;
+
+    class const_iterator
+      : public boost::iterator_facade<const_iterator, const Type,
+            boost::random_access_traversal_tag>
+    {
+    public:
+        const_iterator();
+        const_iterator(const shared_window* window, size_t index);
+
+    private:
+        friend class boost::iterator_core_access;
+
+        const Type& dereference() const;
+        bool equal(const const_iterator& other) const;
+        void increment();
+        void decrement();
+        void advance(std::ptrdiff_t offset);
+        std::ptrdiff_t distance_to(const const_iterator& other) const;
+
+        const shared_window* window_;
+        size_t index_;
+    };
+
+    typedef const_iterator iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    shared_window();
+
+    /// Construct from a populated container range, such as a deque.
+    template <typename Iterator>
+    shared_window(Iterator first, Iterator last);
+
+    /// Replace all values with those of a populated container range.
+    template <typename Iterator>
+    void assign(Iterator first, Iterator last);
+
+    /// Append a value, sharing the tail chunk where possible.
+    void push_back(const Type& value);
+
+    /// Drop the oldest value, releasing its chunk once fully consumed.
+    void pop_front();
+
+    /// Release all values.
+    void clear();
+
+    size_t size() const;
+    bool empty() const;
+
+    const Type& front() const;
+    const Type& back() const;
+    const Type& operator[](size_t index) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crbegin() const;
+    const_reverse_iterator crend() const;
+
+private:
+    struct chunk
+    {
+        chunk();
+
+        // Number of slots claimed by any window sharing this chunk.
+        std::atomic<size_t> filled;
+        std::array<Type, Chunk> values;
+    };
+
+    typedef std::shared_ptr<chunk> chunk_ptr;
+
+    std::vector<chunk_ptr> chunks_;
+    size_t first_;
+    size_t size_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/utility/shared_window.ipp>
+
+#endif
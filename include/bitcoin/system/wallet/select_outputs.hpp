@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/chain/points_index.hpp>
 #include <bitcoin/system/chain/points_value.hpp>
 
 namespace libbitcoin {
@@ -38,20 +39,45 @@ struct BC_API select_outputs
 
         /// A set of individually sufficient unspent outputs. Each individual
         /// member of the set is sufficient. Return ascending order by value.
-        individual
+        individual,
+
+        /// A set of unspent outputs with total effective value (value less
+        /// input fee) within the cost of change above the minimum value, so
+        /// that no change output is required. The set with least excess found
+        /// within a bounded depth first search is returned, or none.
+        branch_and_bound
     };
 
     /// Select outpoints for a spend from a list of unspent outputs.
+    /// Branch and bound requires an exact match (no input fee or change).
     static void select(chain::points_value& out,
         const chain::points_value& unspent, uint64_t minimum_value,
         algorithm option=algorithm::greedy);
 
+    /// Select outpoints for a spend from an index of unspent outputs, without
+    /// copying or sorting the unspent outputs. The input fee and cost of
+    /// change apply only to branch and bound.
+    static void select(chain::points_value& out,
+        const chain::points_index& unspent, uint64_t minimum_value,
+        algorithm option=algorithm::greedy, uint64_t input_fee=0,
+        uint64_t cost_of_change=0);
+
 private:
     static void greedy(chain::points_value& out,
         const chain::points_value& unspent, uint64_t minimum_value);
 
     static void individual(chain::points_value& out,
         const chain::points_value& unspent, uint64_t minimum_value);
+
+    static void greedy(chain::points_value& out,
+        const chain::points_index& unspent, uint64_t minimum_value);
+
+    static void individual(chain::points_value& out,
+        const chain::points_index& unspent, uint64_t minimum_value);
+
+    static void branch_and_bound(chain::points_value& out,
+        const chain::points_index& unspent, uint64_t minimum_value,
+        uint64_t input_fee, uint64_t cost_of_change);
 };
 
 } // namespace wallet
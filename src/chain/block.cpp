@@ -47,6 +47,9 @@
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
 #include <bitcoin/system/utility/ostream_writer.hpp>
+#include <bitcoin/system/utility/parallel_for.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -163,8 +166,8 @@ block block::factory(reader& source, bool witness)
 
 bool block::from_data(const data_chunk& data, bool witness)
 {
-    data_source istream(data);
-    return from_data(istream, witness);
+    byte_reader source(data);
+    return from_data(source, witness);
 }
 
 bool block::from_data(std::istream& stream, bool witness)
@@ -173,8 +176,10 @@ bool block::from_data(std::istream& stream, bool witness)
     return from_data(source, witness);
 }
 
+// private
 // Full block deserialization is always canonical encoding.
-bool block::from_data(reader& source, bool witness)
+template <class Source>
+bool block::deserialize(Source& source, bool witness)
 {
     const auto start = asio::steady_clock::now();
 
@@ -207,6 +212,16 @@ bool block::from_data(reader& source, bool witness)
     return source;
 }
 
+bool block::from_data(reader& source, bool witness)
+{
+    return deserialize(source, witness);
+}
+
+bool block::from_data(byte_reader& source, bool witness)
+{
+    return deserialize(source, witness);
+}
+
 // private
 void block::reset()
 {
@@ -256,16 +271,7 @@ void block::to_data(writer& sink, bool witness) const
 
 hash_list block::to_hashes(bool witness) const
 {
-    hash_list out;
-    out.reserve(transactions_.size());
-    const auto to_hash = [&out, witness](const transaction& tx)
-    {
-        out.push_back(tx.hash(witness));
-    };
-
-    // Hash ordering matters, don't use std::transform here.
-    std::for_each(transactions_.begin(), transactions_.end(), to_hash);
-    return out;
+    return transaction::hashes(transactions_, witness);
 }
 
 // Properties (size, accessors, cache).
@@ -590,23 +596,15 @@ hash_digest block::generate_merkle_root(bool witness) const
     if (transactions_.empty())
         return null_hash;
 
-    hash_list update;
     auto merkle = to_hashes(witness);
 
-    // Initial capacity is half of the original list (clear doesn't reset).
-    update.reserve((merkle.size() + 1) / 2);
-
     while (merkle.size() > 1)
     {
         // If number of hashes is odd, duplicate last hash in the list.
         if (merkle.size() % 2 != 0)
             merkle.push_back(merkle.back());
 
-        for (auto it = merkle.begin(); it != merkle.end(); it += 2)
-            update.push_back(bitcoin_hash(build_chunk({ it[0], it[1] })));
-
-        std::swap(merkle, update);
-        update.clear();
+        merkle = bitcoin_hash_pairs(merkle);
     }
 
     // There is now only one item in the list.
@@ -718,10 +716,18 @@ bool block::is_valid_witness_commitment() const
 
     // Last output of commitment pattern holds committed value (bip141).
     if (coinbase.inputs().front().extract_reserved_hash(reserved))
+    {
         for (const auto& output: reverse(coinbase.outputs()))
+        {
             if (output.extract_committed_hash(committed))
-                return committed == bitcoin_hash(
-                    build_chunk({ generate_merkle_root(true), reserved }));
+            {
+                sha256_writer sink;
+                sink.write_hash(generate_merkle_root(true));
+                sink.write_hash(reserved);
+                return committed == sink.bitcoin_digest();
+            }
+        }
+    }
 
     // If no txs in block are segregated the commitment is optional (bip141).
     return !is_segregated();
@@ -793,6 +799,33 @@ code block::connect_transactions(const chain_state& state) const
     return error::success;
 }
 
+// Concurrent connect.
+//-----------------------------------------------------------------------------
+
+code block::connect_transactions(const chain_state& state,
+    threadpool& pool) const
+{
+    typedef std::pair<const transaction*, size_t> input_reference;
+
+    // Frozen transactions are read without locking during verification.
+    for (const auto& tx: transactions_)
+        tx.freeze();
+
+    // Coinbase input connection is always successful.
+    std::vector<input_reference> inputs;
+    for (const auto& tx: transactions_)
+        if (!tx.is_coinbase())
+            for (size_t index = 0; index < tx.inputs().size(); ++index)
+                inputs.emplace_back(&tx, index);
+
+    // The first failure in block order is the one reported.
+    return parallel_for(pool, inputs.size(), [&](size_t index)
+    {
+        const auto& input = inputs[index];
+        return input.first->connect_input(state, input.second);
+    });
+}
+
 // Validation.
 //-----------------------------------------------------------------------------
 
@@ -922,6 +955,15 @@ code block::connect(const chain_state& state) const
         return connect_transactions(state);
 }
 
+code block::connect(const chain_state& state, threadpool& pool) const
+{
+    if (state.is_under_checkpoint())
+        return error::success;
+
+    else
+        return connect_transactions(state, pool);
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
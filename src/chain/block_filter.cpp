@@ -0,0 +1,469 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/error.hpp>
+#include <bitcoin/system/machine/opcode.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/siphash.hpp>
+#include <bitcoin/system/message/messages.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/parallel_for.hpp>
+#include <bitcoin/system/utility/serializer.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+using namespace bc::system::machine;
+
+const uint8_t block_filter::basic_type = 0;
+const uint8_t block_filter::basic_rice_bits = 19;
+const uint64_t block_filter::basic_rate = 784931;
+
+// Golomb-Rice coding.
+// ----------------------------------------------------------------------------
+// Bits are most significant first within each byte. The quotient of each
+// delta is written in unary (ones terminated by a zero) and the remainder in
+// the fixed rice bit count.
+
+// Bits are accumulated in a word and written a byte at a time, as the binary
+// class copies its blocks on each append.
+class golomb_writer
+{
+public:
+    golomb_writer(data_chunk& out)
+      : out_(out), buffer_(0), bits_(0)
+    {
+    }
+
+    void write(uint64_t delta, uint8_t rice_bits)
+    {
+        static const uint8_t ones = 32;
+
+        for (auto quotient = delta >> rice_bits; quotient > 0;)
+        {
+            const auto count = static_cast<uint8_t>(
+                std::min(quotient, uint64_t(ones)));
+            write_bits((uint64_t(1) << count) - 1u, count);
+            quotient -= count;
+        }
+
+        write_bits(0, 1);
+        write_bits(delta & ((uint64_t(1) << rice_bits) - 1u), rice_bits);
+    }
+
+    // Pad the final byte with zeros.
+    void flush()
+    {
+        if (bits_ > 0)
+            out_.push_back(static_cast<uint8_t>(buffer_ << (8u - bits_)));
+
+        buffer_ = 0;
+        bits_ = 0;
+    }
+
+private:
+    // The count is at most 32, so the buffer holds at most 39 bits.
+    void write_bits(uint64_t value, uint8_t count)
+    {
+        buffer_ = (buffer_ << count) | value;
+        bits_ += count;
+
+        for (; bits_ >= 8u; bits_ -= 8u)
+            out_.push_back(static_cast<uint8_t>(buffer_ >> (bits_ - 8u)));
+
+        buffer_ &= (uint64_t(1) << bits_) - 1u;
+    }
+
+    data_chunk& out_;
+    uint64_t buffer_;
+    uint8_t bits_;
+};
+
+// The buffer is aligned to its most significant bit and refilled by bytes.
+class golomb_reader
+{
+public:
+    golomb_reader(const uint8_t* begin, const uint8_t* end)
+      : it_(begin), end_(end), buffer_(0), bits_(0)
+    {
+    }
+
+    bool read(uint64_t& delta, uint8_t rice_bits)
+    {
+        uint64_t quotient = 0;
+
+        while (true)
+        {
+            refill();
+
+            if (bits_ == 0)
+                return false;
+
+            const auto bit = (buffer_ >> 63) != 0;
+            skip(1);
+
+            if (!bit)
+                break;
+
+            ++quotient;
+        }
+
+        refill();
+
+        if (bits_ < rice_bits)
+            return false;
+
+        delta = (quotient << rice_bits) | (buffer_ >> (64u - rice_bits));
+        skip(rice_bits);
+        return true;
+    }
+
+private:
+    void refill()
+    {
+        for (; bits_ <= 56u && it_ != end_; bits_ += 8u)
+            buffer_ |= uint64_t(*it_++) << (56u - bits_);
+    }
+
+    void skip(uint8_t count)
+    {
+        buffer_ = count < 64u ? buffer_ << count : 0;
+        bits_ -= count;
+    }
+
+    const uint8_t* it_;
+    const uint8_t* end_;
+    uint64_t buffer_;
+    uint8_t bits_;
+};
+
+// Set values.
+// ----------------------------------------------------------------------------
+
+// The high word of the 128 bit product maps a hash uniformly onto the range.
+static uint64_t multiply_high(uint64_t left, uint64_t right)
+{
+#ifdef __SIZEOF_INT128__
+    typedef unsigned __int128 uint128_t;
+    return static_cast<uint64_t>(
+        (static_cast<uint128_t>(left) * right) >> 64);
+#else
+    static const uint64_t low_mask = 0xffffffff;
+    const auto left_low = left & low_mask;
+    const auto left_high = left >> 32;
+    const auto right_low = right & low_mask;
+    const auto right_high = right >> 32;
+    const auto low = left_low * right_low;
+    const auto middle1 = left_high * right_low + (low >> 32);
+    const auto middle2 = left_low * right_high + (middle1 & low_mask);
+    return left_high * right_high + (middle1 >> 32) + (middle2 >> 32);
+#endif
+}
+
+static siphash_key to_key(const hash_digest& block_hash)
+{
+    half_hash key;
+    std::copy(block_hash.begin(), block_hash.begin() + half_hash_size,
+        key.begin());
+    return to_siphash_key(key);
+}
+
+template <typename Element>
+static std::vector<uint64_t> to_sorted_values(const hash_digest& block_hash,
+    const std::vector<Element>& elements, uint64_t count)
+{
+    const auto key = to_key(block_hash);
+    const auto range = count * block_filter::basic_rate;
+    std::vector<uint64_t> out;
+    out.reserve(elements.size());
+
+    for (const auto& element: elements)
+        out.push_back(multiply_high(siphash(key, element), range));
+
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+block_filter::block_filter()
+  : block_hash_(null_hash), encoded_()
+{
+}
+
+block_filter::block_filter(const hash_digest& block_hash,
+    data_chunk&& encoded)
+  : block_hash_(block_hash), encoded_(std::move(encoded))
+{
+}
+
+block_filter::block_filter(const hash_digest& block_hash,
+    const data_chunk& encoded)
+  : block_hash_(block_hash), encoded_(encoded)
+{
+}
+
+block_filter::block_filter(const block& block)
+  : block_hash_(block.hash())
+{
+    std::vector<data_slice> elements;
+    add_outputs(elements, block);
+
+    for (const auto& tx: block.transactions())
+        if (!tx.is_coinbase())
+            for (const auto& input: tx.inputs())
+                elements.push_back(input.previous_output().metadata.cache.
+                    script().encoded());
+
+    encoded_ = encode(block_hash_, elements);
+}
+
+block_filter::block_filter(const block& block, const output::list& spent)
+  : block_hash_(block.hash())
+{
+    std::vector<data_slice> elements;
+    add_outputs(elements, block);
+
+    for (const auto& output: spent)
+        elements.push_back(output.script().encoded());
+
+    encoded_ = encode(block_hash_, elements);
+}
+
+// private
+// Output scripts are elements unless empty or provably unspendable (null
+// data), spent output scripts are filtered for empty by encode.
+void block_filter::add_outputs(std::vector<data_slice>& elements,
+    const block& block)
+{
+    static const auto null_data = static_cast<uint8_t>(opcode::return_);
+
+    for (const auto& tx: block.transactions())
+    {
+        for (const auto& output: tx.outputs())
+        {
+            const auto script = output.script().encoded();
+
+            if (!script.empty() && *script.begin() != null_data)
+                elements.push_back(script);
+        }
+    }
+}
+
+// private
+data_chunk block_filter::encode(const hash_digest& block_hash,
+    std::vector<data_slice>& elements)
+{
+    const auto less = [](const data_slice& left, const data_slice& right)
+    {
+        return std::lexicographical_compare(left.begin(), left.end(),
+            right.begin(), right.end());
+    };
+
+    const auto equal = [](const data_slice& left, const data_slice& right)
+    {
+        return left.size() == right.size() &&
+            std::equal(left.begin(), left.end(), right.begin());
+    };
+
+    const auto empty = [](const data_slice& element)
+    {
+        return element.empty();
+    };
+
+    // The set is of distinct elements.
+    elements.erase(std::remove_if(elements.begin(), elements.end(), empty),
+        elements.end());
+    std::sort(elements.begin(), elements.end(), less);
+    elements.erase(std::unique(elements.begin(), elements.end(), equal),
+        elements.end());
+
+    const uint64_t count = elements.size();
+    const auto values = to_sorted_values(block_hash, elements, count);
+
+    data_chunk out(message::variable_uint_size(count));
+    auto serial = make_unsafe_serializer(out.begin());
+    serial.write_variable_little_endian(count);
+
+    // The expected encoding is rice bits plus two bits per element.
+    out.reserve(out.size() + (count * (basic_rice_bits + 2u) + 7u) / 8u);
+    golomb_writer writer(out);
+    uint64_t previous = 0;
+
+    for (const auto value: values)
+    {
+        writer.write(value - previous, basic_rice_bits);
+        previous = value;
+    }
+
+    writer.flush();
+    return out;
+}
+
+// Concurrent build.
+// ----------------------------------------------------------------------------
+
+block_filter::list block_filter::basic_filters(const block::list& blocks,
+    threadpool& pool)
+{
+    // Each filter is written only by the thread that claimed its block.
+    list filters(blocks.size());
+    parallel_for(pool, blocks.size(), [&](size_t index)
+    {
+        filters[index] = block_filter(blocks[index]);
+        return error::success;
+    });
+
+    return filters;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+const hash_digest& block_filter::block_hash() const
+{
+    return block_hash_;
+}
+
+const data_chunk& block_filter::encoded() const
+{
+    return encoded_;
+}
+
+uint64_t block_filter::size() const
+{
+    byte_reader source(encoded_);
+    const auto count = source.read_variable_little_endian();
+    return source ? count : 0;
+}
+
+hash_digest block_filter::hash() const
+{
+    return bitcoin_hash(encoded_);
+}
+
+hash_digest block_filter::header(const hash_digest& previous_header) const
+{
+    byte_array<2u * hash_size> preimage;
+    const auto filter_hash = hash();
+    std::copy(filter_hash.begin(), filter_hash.end(), preimage.begin());
+    std::copy(previous_header.begin(), previous_header.end(),
+        preimage.begin() + hash_size);
+    return bitcoin_hash(preimage);
+}
+
+hash_list block_filter::headers(const list& filters,
+    const hash_digest& previous_header)
+{
+    hash_list out;
+    out.reserve(filters.size());
+    auto previous = previous_header;
+
+    for (const auto& filter: filters)
+    {
+        previous = filter.header(previous);
+        out.push_back(previous);
+    }
+
+    return out;
+}
+
+// Matching.
+// ----------------------------------------------------------------------------
+
+bool block_filter::match(const data_slice& element) const
+{
+    const auto count = size();
+
+    if (count == 0)
+        return false;
+
+    const std::vector<data_slice> elements{ element };
+    return match(to_sorted_values(block_hash_, elements, count), count);
+}
+
+bool block_filter::match(const data_stack& elements) const
+{
+    const auto count = size();
+
+    if (count == 0 || elements.empty())
+        return false;
+
+    return match(to_sorted_values(block_hash_, elements, count), count);
+}
+
+// private
+// The set and the sorted queries are walked together, each advancing past the
+// lesser value, so the set is decoded at most once for all queries.
+bool block_filter::match(const values& sorted, uint64_t count) const
+{
+    const auto prefix = message::variable_uint_size(count);
+    golomb_reader reader(encoded_.data() + prefix,
+        encoded_.data() + encoded_.size());
+
+    auto query = sorted.begin();
+    uint64_t value = 0;
+
+    for (uint64_t element = 0; element < count; ++element)
+    {
+        uint64_t delta;
+        if (!reader.read(delta, basic_rice_bits))
+            return false;
+
+        value += delta;
+
+        while (query != sorted.end() && *query < value)
+            ++query;
+
+        if (query == sorted.end())
+            return false;
+
+        if (*query == value)
+            return true;
+    }
+
+    return false;
+}
+
+bool block_filter::operator==(const block_filter& other) const
+{
+    return block_hash_ == other.block_hash_ && encoded_ == other.encoded_;
+}
+
+bool block_filter::operator!=(const block_filter& other) const
+{
+    return !(*this == other);
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
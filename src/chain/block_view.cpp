@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/monotonic_arena.hpp>
+#include "wire_parser.hpp"
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+block_view::block_view()
+  : buffer_(nullptr), size_(0)
+{
+}
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+// static
+block_view block_view::factory(data_chunk&& data)
+{
+    block_view instance;
+    instance.from_data(std::move(data));
+    return instance;
+}
+
+// static
+block_view block_view::factory(const buffer_ptr& buffer)
+{
+    block_view instance;
+    instance.from_data(buffer);
+    return instance;
+}
+
+bool block_view::from_data(data_chunk&& data)
+{
+    return from_data(std::make_shared<const data_chunk>(std::move(data)));
+}
+
+// This follows block::from_data, retaining only transaction offsets.
+// The offsets of all transactions are allocated from one arena, which is
+// released in one step when the last view of the block is destroyed.
+bool block_view::from_data(const buffer_ptr& buffer)
+{
+    reset();
+
+    if (!buffer)
+        return false;
+
+    wire_parser source(*buffer, 0);
+    source.skip(header::satoshi_fixed_size());
+    transactions_.resize(source.read_size_little_endian());
+
+    // Size the first arena block for the parsed transaction count, assuming
+    // one input and two outputs each, and bounded by the buffer size. The
+    // block is allocated on first use and the arena grows as required.
+    const auto typical = transaction_view::offsets_size(1, 2);
+    const auto arena = std::make_shared<monotonic_arena>(std::min(
+        buffer->size(), transactions_.size() * typical));
+
+    for (auto& tx: transactions_)
+    {
+        if (!source.is_valid() ||
+            !tx.from_data(buffer, source.position(), arena))
+        {
+            source.invalidate();
+            break;
+        }
+
+        source.skip(tx.serialized_size());
+    }
+
+    if (!source.is_valid())
+    {
+        reset();
+        return false;
+    }
+
+    buffer_ = buffer;
+    size_ = source.position();
+    return true;
+}
+
+// protected
+void block_view::reset()
+{
+    buffer_.reset();
+    size_ = 0;
+    transactions_.clear();
+    transactions_.shrink_to_fit();
+}
+
+bool block_view::is_valid() const
+{
+    return buffer_ != nullptr;
+}
+
+// Serialization.
+//-----------------------------------------------------------------------------
+
+data_slice block_view::data() const
+{
+    return buffer_ ? data_slice{ buffer_->data(), buffer_->data() + size_ } :
+        data_slice{ nullptr, nullptr };
+}
+
+size_t block_view::serialized_size() const
+{
+    return size_;
+}
+
+block block_view::to_block(bool witness) const
+{
+    return block::factory(to_chunk(data()), witness);
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+chain::header block_view::header() const
+{
+    if (!buffer_)
+        return{};
+
+    const auto begin = buffer_->begin();
+    return header::factory({ begin, begin + header::satoshi_fixed_size() });
+}
+
+hash_digest block_view::hash() const
+{
+    if (!buffer_)
+        return null_hash;
+
+    const auto begin = buffer_->data();
+    return bitcoin_hash({ begin, begin + header::satoshi_fixed_size() });
+}
+
+const transaction_view::list& block_view::transactions() const
+{
+    return transactions_;
+}
+
+// Validation.
+//-----------------------------------------------------------------------------
+
+hash_digest block_view::generate_merkle_root(bool witness) const
+{
+    if (transactions_.empty())
+        return null_hash;
+
+    auto merkle = transaction_view::hashes(transactions_, witness);
+
+    while (merkle.size() > 1)
+    {
+        // If number of hashes is odd, duplicate last hash in the list.
+        if (merkle.size() % 2 != 0)
+            merkle.push_back(merkle.back());
+
+        merkle = bitcoin_hash_pairs(merkle);
+    }
+
+    // There is now only one item in the list.
+    return merkle.front();
+}
+
+bool block_view::is_valid_merkle_root() const
+{
+    return generate_merkle_root() == header().merkle_root();
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
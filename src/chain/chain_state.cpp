@@ -19,10 +19,11 @@
 #include <bitcoin/system/chain/chain_state.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
-#include <boost/multiprecision/integer.hpp>
+#include <vector>
 #include <boost/range/adaptor/reversed.hpp>
 #include <bitcoin/system/chain/block.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
@@ -32,6 +33,7 @@
 #include <bitcoin/system/constants.hpp>
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/math/limits.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/rule_fork.hpp>
 #include <bitcoin/system/settings.hpp>
@@ -278,15 +280,32 @@ size_t chain_state::bip9_bit1_height(size_t height,
 
 uint32_t chain_state::median_time_past(const data& values, uint32_t)
 {
-    // Create a copy for the in-place sort.
-    auto times = values.timestamp.ordered;
+    const auto& ordered = values.timestamp.ordered;
 
-    // Sort the times by value to obtain the median.
-    std::sort(times.begin(), times.end());
+    if (ordered.empty())
+        return 0;
+
+    // The window is bounded by timestamp_count, so select on the stack.
+    std::array<uint32_t, median_time_past_interval> buffer;
+    std::vector<uint32_t> overflow;
+    auto times = buffer.data();
+
+    // Tolerate an oversized window from the raw data constructor.
+    if (ordered.size() > buffer.size())
+    {
+        overflow.resize(ordered.size());
+        times = overflow.data();
+    }
+
+    const auto end = std::copy(ordered.begin(), ordered.end(), times);
+    const auto median = times + ordered.size() / 2;
+
+    // Partially order the times by value to obtain the median.
+    std::nth_element(times, median, end);
 
     // Consensus defines median time using modulo 2 element selection.
     // This differs from arithmetic median which averages two middle values.
-    return times.empty() ? 0 : times[times.size() / 2];
+    return *median;
 }
 
 // work_required
@@ -323,17 +342,16 @@ uint32_t chain_state::work_required_retarget(const data& values, uint32_t forks,
     uint32_t proof_of_work_limit, uint32_t minimum_timespan,
     uint32_t maximum_timespan, uint32_t retargeting_interval_seconds)
 {
-    static const uint256_t pow_limit(compact{ proof_of_work_limit });
+    static const auto pow_limit = compact{ proof_of_work_limit }.big();
 
     const compact bits(bits_high(values));
     BITCOIN_ASSERT_MSG(!bits.is_overflowed(), "previous block has bad bits");
 
-    uint256_t target(bits);
+    auto target = bits.big();
     const auto retarget_overflow = script::is_enabled(forks,
         rule_fork::retarget_overflow_patch);
-    using namespace boost::multiprecision;
-    const auto shift = retarget_overflow && (msb(target) + 1 > msb(pow_limit)) ?
-        1u : 0u;
+    const auto shift = retarget_overflow && !target.is_zero() &&
+        (target.msb() + 1 > pow_limit.msb()) ? 1u : 0u;
     target >>= shift;
     target *= retarget_timespan(values, minimum_timespan, maximum_timespan);
     target /= retargeting_interval_seconds;
@@ -528,6 +546,7 @@ chain_state::data chain_state::to_pool(const chain_state& top,
     const auto retarget = script::is_enabled(forks, rule_fork::retarget);
 
     // Copy data from presumed previous-height block state.
+    // History windows share their chunks with the top state.
     auto data = top.data_;
 
     // If this overflows height is zero and result is handled as invalid.
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 #include <bitcoin/system/utility/assert.hpp>
 
 namespace libbitcoin {
@@ -80,16 +81,6 @@ inline uint32_t shift_high(uint8_t exponent)
     return  8 * (exponent - 3);
 }
 
-inline size_t logical_size(uint256_t value)
-{
-    auto byte = 0;
-
-    for (; value != 0; ++byte)
-        value >>= 8;
-
-    return byte;
-}
-
 // Constructors
 //-----------------------------------------------------------------------------
 
@@ -99,12 +90,17 @@ compact::compact(uint32_t compact)
     normal_ = from_big(big_);
 }
 
-compact::compact(const uint256_t& value)
+compact::compact(const uint256& value)
   : big_(value), overflowed_(false)
 {
     normal_ = from_big(big_);
 }
 
+compact::compact(const uint256_t& value)
+  : compact(uint256(value))
+{
+}
+
 bool compact::is_overflowed() const
 {
     return overflowed_;
@@ -115,13 +111,18 @@ uint32_t compact::normal() const
     return normal_;
 }
 
-compact::operator const uint256_t&() const
+const uint256& compact::big() const
 {
     return big_;
 }
 
+compact::operator uint256_t() const
+{
+    return static_cast<uint256_t>(big_);
+}
+
 // Returns false on overflow, negatives are converted to zero.
-bool compact::from_compact(uint256_t& out, uint32_t compact)
+bool compact::from_compact(uint256& out, uint32_t compact)
 {
     //*************************************************************************
     // CONSENSUS: The sign bit is not honored and it instead produces zero.
@@ -157,10 +158,10 @@ bool compact::from_compact(uint256_t& out, uint32_t compact)
     return true;
 }
 
-uint32_t compact::from_big(const uint256_t& big)
+uint32_t compact::from_big(const uint256& big)
 {
     // This value is limited to 32, so exponent cannot overflow.
-    auto exponent = static_cast<uint8_t>(logical_size(big));
+    auto exponent = static_cast<uint8_t>(big.bytes());
 
     // Shift the big number significant digits into the mantissa.
     const auto mantissa64 = exponent <= 3 ?
@@ -26,10 +26,12 @@
 #include <bitcoin/system/constants.hpp>
 #include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
 #include <bitcoin/system/utility/ostream_writer.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -191,8 +193,8 @@ header header::factory(reader& source, const hash_digest& hash, bool wire)
 
 bool header::from_data(const data_chunk& data, bool wire)
 {
-    data_source istream(data);
-    return from_data(istream, wire);
+    byte_reader source(data);
+    return from_data(source, wire);
 }
 
 bool header::from_data(std::istream& stream, bool wire)
@@ -201,7 +203,9 @@ bool header::from_data(std::istream& stream, bool wire)
     return from_data(source, wire);
 }
 
-bool header::from_data(reader& source, bool)
+// private
+template <class Source>
+bool header::deserialize(Source& source)
 {
     ////reset();
 
@@ -218,6 +222,16 @@ bool header::from_data(reader& source, bool)
     return source;
 }
 
+bool header::from_data(reader& source, bool)
+{
+    return deserialize(source);
+}
+
+bool header::from_data(byte_reader& source, bool)
+{
+    return deserialize(source);
+}
+
 bool header::from_data(reader& source, hash_digest&& hash, bool wire)
 {
     if (!from_data(source, wire))
@@ -412,6 +426,17 @@ void header::invalidate_cache() const
     ///////////////////////////////////////////////////////////////////////////
 }
 
+// protected
+void header::cache_hash(const hash_digest& hash) const
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    mutex_.lock();
+    hash_ = std::make_shared<hash_digest>(hash);
+    mutex_.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
 hash_digest header::hash() const
 {
     ///////////////////////////////////////////////////////////////////////////
@@ -422,7 +447,9 @@ hash_digest header::hash() const
     {
         //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         mutex_.unlock_upgrade_and_lock();
-        hash_ = std::make_shared<hash_digest>(bitcoin_hash(to_data()));
+        sha256_writer sink;
+        to_data(sink, true);
+        hash_ = std::make_shared<hash_digest>(sink.bitcoin_digest());
         mutex_.unlock_and_lock_upgrade();
         //---------------------------------------------------------------------
     }
@@ -451,19 +478,19 @@ bool header::is_valid_proof_of_work(uint32_t proof_of_work_limit,
     bool scrypt) const
 {
     const auto bits = compact(bits_);
-    static const uint256_t pow_limit(compact{ proof_of_work_limit });
+    static const auto pow_limit = compact{ proof_of_work_limit }.big();
 
     if (bits.is_overflowed())
         return false;
 
-    uint256_t target(bits);
+    const auto& target = bits.big();
 
     // Ensure claimed work is within limits.
     if (target < 1 || target > pow_limit)
         return false;
 
     // Ensure actual work is at least claimed amount (smaller is more work).
-    return to_uint256(scrypt ? scrypt_hash(to_data()) : hash()) <= target;
+    return uint256(scrypt ? scrypt_hash(to_data()) : hash()) <= target;
 }
 
 // static
@@ -474,7 +501,7 @@ uint256_t header::proof(uint32_t bits)
     if (header_bits.is_overflowed())
         return 0;
 
-    uint256_t target(header_bits);
+    const auto& target = header_bits.big();
 
     //*************************************************************************
     // CONSENSUS: satoshi will throw division by zero in the case where the
@@ -488,7 +515,8 @@ uint256_t header::proof(uint32_t bits)
     // as it's too large for uint256. However as 2**256 is at least as large as
     // target + 1, it is equal to ((2**256 - target - 1) / (target + 1)) + 1, or
     // (~target / (target + 1)) + 1.
-    return (divisor == 0) ? 0 : (~target / divisor) + 1;
+    return divisor.is_zero() ? 0 :
+        static_cast<uint256_t>((~target / divisor) + 1);
 }
 
 uint256_t header::proof() const
@@ -25,6 +25,7 @@
 #include <bitcoin/system/constants.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
@@ -156,8 +157,8 @@ payment_record payment_record::factory(reader& source, bool wire)
 
 bool payment_record::from_data(const data_chunk& data, bool wire)
 {
-    data_source istream(data);
-    return from_data(istream, wire);
+    byte_reader source(data);
+    return from_data(source, wire);
 }
 
 bool payment_record::from_data(std::istream& stream, bool wire)
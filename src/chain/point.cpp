@@ -150,8 +150,8 @@ point point::factory(reader& source, bool wire)
 
 bool point::from_data(const data_chunk& data, bool wire)
 {
-    data_source istream(data);
-    return from_data(istream, wire);
+    byte_reader source(data);
+    return from_data(source, wire);
 }
 
 bool point::from_data(std::istream& stream, bool wire)
@@ -160,7 +160,9 @@ bool point::from_data(std::istream& stream, bool wire)
     return from_data(source, wire);
 }
 
-bool point::from_data(reader& source, bool wire)
+// private
+template <class Source>
+bool point::deserialize(Source& source, bool wire)
 {
     reset();
 
@@ -186,6 +188,16 @@ bool point::from_data(reader& source, bool wire)
     return source;
 }
 
+bool point::from_data(reader& source, bool wire)
+{
+    return deserialize(source, wire);
+}
+
+bool point::from_data(byte_reader& source, bool wire)
+{
+    return deserialize(source, wire);
+}
+
 // protected
 void point::reset()
 {
@@ -0,0 +1,472 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/points_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/chain/point_value.hpp>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/math/limits.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+static const size_t none = max_size_t;
+
+static bool lesser(const point_value& left, const point_value& right)
+{
+    return left.value() < right.value() ||
+        (left.value() == right.value() &&
+            static_cast<const point&>(left) < static_cast<const point&>(right));
+}
+
+// splitmix64, a deterministic source of well distributed node priorities.
+static uint64_t mix(uint64_t& seed)
+{
+    auto value = (seed += 0x9e3779b97f4a7c15);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+// const_iterator
+// ----------------------------------------------------------------------------
+
+points_index::const_iterator::const_iterator()
+  : index_(nullptr), position_(none)
+{
+}
+
+points_index::const_iterator::const_iterator(const points_index* index,
+    size_t position)
+  : index_(index), position_(position)
+{
+}
+
+const point_value& points_index::const_iterator::dereference() const
+{
+    return index_->nodes_[position_].point;
+}
+
+bool points_index::const_iterator::equal(const const_iterator& other) const
+{
+    return position_ == other.position_;
+}
+
+void points_index::const_iterator::increment()
+{
+    position_ = index_->next(position_);
+}
+
+void points_index::const_iterator::decrement()
+{
+    position_ = position_ == none ? index_->last(index_->root_) :
+        index_->previous(position_);
+}
+
+// points_index
+// ----------------------------------------------------------------------------
+
+points_index::points_index()
+  : root_(none), seed_(0)
+{
+}
+
+points_index::points_index(const point_value::list& points)
+  : root_(none), seed_(0)
+{
+    auto sorted = points;
+    std::sort(sorted.begin(), sorted.end(), lesser);
+    nodes_.reserve(sorted.size());
+
+    // Build in linear time from sorted points, maintaining the right spine.
+    // A node popped from the spine is complete, so it is summarized then.
+    std::vector<size_t> spine;
+    uint64_t total = 0;
+
+    for (const auto& point: sorted)
+    {
+        total = safe_add(total, point.value());
+        const auto position = allocate(point);
+        auto child = none;
+
+        while (!spine.empty() &&
+            nodes_[spine.back()].priority < nodes_[position].priority)
+        {
+            child = spine.back();
+            spine.pop_back();
+            update(child);
+        }
+
+        nodes_[position].left = child;
+
+        if (!spine.empty())
+            nodes_[spine.back()].right = position;
+
+        spine.push_back(position);
+    }
+
+    if (!spine.empty())
+        root_ = spine.front();
+
+    while (!spine.empty())
+    {
+        update(spine.back());
+        spine.pop_back();
+    }
+}
+
+void points_index::insert(const point_value& point)
+{
+    // Guard the total before modifying the tree, as subtotals cannot exceed it.
+    safe_add(value(), point.value());
+
+    const auto position = allocate(point);
+    auto parent = none;
+
+    // Descend to a leaf after any equal points, accumulating along the path.
+    for (auto child = root_; child != none;)
+    {
+        auto& node = nodes_[child];
+        node.sum += point.value();
+        ++node.count;
+        parent = child;
+        child = lesser(point, node.point) ? node.left : node.right;
+    }
+
+    nodes_[position].parent = parent;
+
+    if (parent == none)
+        root_ = position;
+    else if (lesser(point, nodes_[parent].point))
+        nodes_[parent].left = position;
+    else
+        nodes_[parent].right = position;
+
+    // Restore heap order of priorities.
+    while (nodes_[position].parent != none &&
+        nodes_[nodes_[position].parent].priority < nodes_[position].priority)
+        rotate(position);
+}
+
+bool points_index::erase(const point_value& point)
+{
+    auto position = root_;
+
+    while (position != none && nodes_[position].point != point)
+        position = lesser(point, nodes_[position].point) ?
+            nodes_[position].left : nodes_[position].right;
+
+    if (position == none)
+        return false;
+
+    // Rotate the point down until it has at most one child.
+    while (nodes_[position].left != none && nodes_[position].right != none)
+    {
+        const auto& node = nodes_[position];
+        rotate(nodes_[node.left].priority > nodes_[node.right].priority ?
+            node.left : node.right);
+    }
+
+    const auto& node = nodes_[position];
+    const auto child = node.left == none ? node.right : node.left;
+    const auto parent = node.parent;
+
+    if (child != none)
+        nodes_[child].parent = parent;
+
+    if (parent == none)
+        root_ = child;
+    else if (nodes_[parent].left == position)
+        nodes_[parent].left = child;
+    else
+        nodes_[parent].right = child;
+
+    // Remove the point from the summary of each ancestor.
+    for (auto ancestor = parent; ancestor != none;
+        ancestor = nodes_[ancestor].parent)
+    {
+        nodes_[ancestor].sum -= point.value();
+        --nodes_[ancestor].count;
+    }
+
+    release(position);
+    return true;
+}
+
+void points_index::clear()
+{
+    nodes_.clear();
+    free_.clear();
+    root_ = none;
+}
+
+size_t points_index::size() const
+{
+    return count(root_);
+}
+
+bool points_index::empty() const
+{
+    return root_ == none;
+}
+
+uint64_t points_index::value() const
+{
+    return sum(root_);
+}
+
+uint64_t points_index::value(const const_iterator& position) const
+{
+    auto child = position.position_;
+
+    if (child == none)
+        return value();
+
+    auto total = sum(nodes_[child].left);
+
+    for (auto parent = nodes_[child].parent; parent != none;
+        child = parent, parent = nodes_[parent].parent)
+    {
+        const auto& node = nodes_[parent];
+
+        if (node.right == child)
+            total += sum(node.left) + node.point.value();
+    }
+
+    return total;
+}
+
+points_index::const_iterator points_index::lower_bound(uint64_t value) const
+{
+    auto result = none;
+
+    for (auto position = root_; position != none;)
+    {
+        const auto& node = nodes_[position];
+
+        if (node.point.value() < value)
+        {
+            position = node.right;
+        }
+        else
+        {
+            result = position;
+            position = node.left;
+        }
+    }
+
+    return const_iterator(this, result);
+}
+
+points_index::const_iterator points_index::upper_bound(uint64_t value) const
+{
+    auto result = none;
+
+    for (auto position = root_; position != none;)
+    {
+        const auto& node = nodes_[position];
+
+        if (node.point.value() <= value)
+        {
+            position = node.right;
+        }
+        else
+        {
+            result = position;
+            position = node.left;
+        }
+    }
+
+    return const_iterator(this, result);
+}
+
+points_index::const_iterator points_index::partition_point(
+    uint64_t total) const
+{
+    uint64_t preceding = 0;
+
+    for (auto position = root_; position != none;)
+    {
+        const auto& node = nodes_[position];
+        const auto before = preceding + sum(node.left);
+
+        if (before > total)
+        {
+            position = node.left;
+        }
+        else if (before + node.point.value() > total)
+        {
+            return const_iterator(this, position);
+        }
+        else
+        {
+            preceding = before + node.point.value();
+            position = node.right;
+        }
+    }
+
+    return end();
+}
+
+points_index::const_iterator points_index::begin() const
+{
+    return const_iterator(this, first(root_));
+}
+
+points_index::const_iterator points_index::end() const
+{
+    return const_iterator(this, none);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t points_index::allocate(const point_value& point)
+{
+    const node value{ point, mix(seed_), point.value(), 1, none, none, none };
+
+    if (free_.empty())
+    {
+        nodes_.push_back(value);
+        return nodes_.size() - 1;
+    }
+
+    const auto position = free_.back();
+    free_.pop_back();
+    nodes_[position] = value;
+    return position;
+}
+
+void points_index::release(size_t position)
+{
+    free_.push_back(position);
+}
+
+void points_index::update(size_t position)
+{
+    auto& node = nodes_[position];
+    node.count = 1 + count(node.left) + count(node.right);
+    node.sum = node.point.value() + sum(node.left) + sum(node.right);
+
+    if (node.left != none)
+        nodes_[node.left].parent = position;
+
+    if (node.right != none)
+        nodes_[node.right].parent = position;
+}
+
+size_t points_index::count(size_t position) const
+{
+    return position == none ? 0 : nodes_[position].count;
+}
+
+uint64_t points_index::sum(size_t position) const
+{
+    return position == none ? 0 : nodes_[position].sum;
+}
+
+size_t points_index::first(size_t position) const
+{
+    if (position != none)
+        while (nodes_[position].left != none)
+            position = nodes_[position].left;
+
+    return position;
+}
+
+size_t points_index::last(size_t position) const
+{
+    if (position != none)
+        while (nodes_[position].right != none)
+            position = nodes_[position].right;
+
+    return position;
+}
+
+size_t points_index::next(size_t position) const
+{
+    if (nodes_[position].right != none)
+        return first(nodes_[position].right);
+
+    auto parent = nodes_[position].parent;
+
+    while (parent != none && nodes_[parent].right == position)
+    {
+        position = parent;
+        parent = nodes_[parent].parent;
+    }
+
+    return parent;
+}
+
+size_t points_index::previous(size_t position) const
+{
+    if (nodes_[position].left != none)
+        return last(nodes_[position].left);
+
+    auto parent = nodes_[position].parent;
+
+    while (parent != none && nodes_[parent].left == position)
+    {
+        position = parent;
+        parent = nodes_[parent].parent;
+    }
+
+    return parent;
+}
+
+// Rotate the node above its parent, preserving order.
+void points_index::rotate(size_t position)
+{
+    auto& node = nodes_[position];
+    const auto parent = node.parent;
+    auto& above = nodes_[parent];
+    const auto grandparent = above.parent;
+
+    if (above.left == position)
+    {
+        above.left = node.right;
+        node.right = parent;
+    }
+    else
+    {
+        above.right = node.left;
+        node.left = parent;
+    }
+
+    node.parent = grandparent;
+
+    if (grandparent == none)
+        root_ = position;
+    else if (nodes_[grandparent].left == parent)
+        nodes_[grandparent].left = position;
+    else
+        nodes_[grandparent].right = position;
+
+    update(parent);
+    update(position);
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -33,6 +33,7 @@
 #include <bitcoin/system/formats/base_16.hpp>
 #include <bitcoin/system/math/elliptic_curve.hpp>
 #include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/signature_cache.hpp>
 #include <bitcoin/system/machine/opcode.hpp>
 #include <bitcoin/system/machine/operation.hpp>
 #include <bitcoin/system/machine/program.hpp>
@@ -47,6 +48,7 @@
 #include <bitcoin/system/utility/data.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
 #include <bitcoin/system/utility/ostream_writer.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
 #include <bitcoin/system/utility/string.hpp>
 
 namespace libbitcoin {
@@ -191,8 +193,8 @@ script script::factory(reader& source, bool prefix)
 
 bool script::from_data(const data_chunk& encoded, bool prefix)
 {
-    data_source istream(encoded);
-    return from_data(istream, prefix);
+    byte_reader source(encoded);
+    return from_data(source, prefix);
 }
 
 bool script::from_data(std::istream& stream, bool prefix)
@@ -201,8 +203,10 @@ bool script::from_data(std::istream& stream, bool prefix)
     return from_data(source, prefix);
 }
 
+// private
 // Concurrent read/write is not supported, so no critical section.
-bool script::from_data(reader& source, bool prefix)
+template <class Source>
+bool script::deserialize(Source& source, bool prefix)
 {
     reset();
     valid_ = true;
@@ -229,6 +233,16 @@ bool script::from_data(reader& source, bool prefix)
     return source;
 }
 
+bool script::from_data(reader& source, bool prefix)
+{
+    return deserialize(source, prefix);
+}
+
+bool script::from_data(byte_reader& source, bool prefix)
+{
+    return deserialize(source, prefix);
+}
+
 // Concurrent read/write is not supported, so no critical section.
 bool script::from_string(const std::string& mnemonic)
 {
@@ -428,6 +442,11 @@ size_t script::serialized_size(bool prefix) const
     return size;
 }
 
+data_slice script::encoded() const
+{
+    return bytes_;
+}
+
 // protected
 const operation::list& script::operations() const
 {
@@ -443,8 +462,7 @@ const operation::list& script::operations() const
     }
 
     operation op;
-    data_source istream(bytes_);
-    istream_reader source(istream);
+    byte_reader source(bytes_);
     const auto size = bytes_.size();
 
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -486,9 +504,10 @@ inline hash_digest signature_hash(const transaction& tx, uint32_t sighash_type)
     // There is no rational interpretation of a signature hash for a coinbase.
     BITCOIN_ASSERT(!tx.is_coinbase());
 
-    auto serialized = tx.to_data(true, false);
-    extend_data(serialized, to_little_endian(sighash_type));
-    return bitcoin_hash(serialized);
+    sha256_writer sink;
+    tx.to_data(sink, true, false);
+    sink.write_4_bytes_little_endian(sighash_type);
+    return sink.bitcoin_digest();
 }
 
 //*****************************************************************************
@@ -668,91 +687,49 @@ hash_digest script::generate_unversioned_signature_hash(const transaction& tx,
 
 hash_digest script::to_outputs(const transaction& tx)
 {
-    const auto sum = [&](size_t total, const output& output)
-    {
-        return total + output.serialized_size();
-    };
+    sha256_writer sink;
 
-    const auto& outs = tx.outputs();
-    auto size = std::accumulate(outs.begin(), outs.end(), size_t(0), sum);
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
-
-    const auto write = [&](const output& output)
-    {
+    for (const auto& output: tx.outputs())
         output.to_data(sink, true);
-    };
 
-    std::for_each(outs.begin(), outs.end(), write);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
 hash_digest script::to_inpoints(const transaction& tx)
 {
-    const auto sum = [&](size_t total, const input& input)
-    {
-        return total + input.previous_output().serialized_size();
-    };
+    sha256_writer sink;
 
-    const auto& ins = tx.inputs();
-    auto size = std::accumulate(ins.begin(), ins.end(), size_t(0), sum);
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
-
-    const auto write = [&](const input& input)
-    {
+    for (const auto& input: tx.inputs())
         input.previous_output().to_data(sink);
-    };
 
-    std::for_each(ins.begin(), ins.end(), write);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
 hash_digest script::to_sequences(const transaction& tx)
 {
-    const auto sum = [&](size_t total, const input& /* input */)
-    {
-        return total + sizeof(uint32_t);
-    };
+    sha256_writer sink;
 
-    const auto& ins = tx.inputs();
-    auto size = std::accumulate(ins.begin(), ins.end(), size_t(0), sum);
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
-
-    const auto write = [&](const input& input)
-    {
+    for (const auto& input: tx.inputs())
         sink.write_4_bytes_little_endian(input.sequence());
-    };
 
-    std::for_each(ins.begin(), ins.end(), write);
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
+}
+
+// The hash of the output at the index of the input (bip143).
+static hash_digest to_output(const transaction& tx, uint32_t input_index)
+{
+    sha256_writer sink;
+    tx.outputs()[input_index].to_data(sink, true);
+    return sink.bitcoin_digest();
 }
 
-static size_t preimage_size(size_t script_size)
+// Anyone-can-pay commits only to version (null hashes), so is not cached.
+static sha256_state anyone_midstate(uint32_t version)
 {
-    return sizeof(uint32_t)
-        + hash_size
-        + hash_size
-        + point::satoshi_fixed_size()
-        + script_size
-        + sizeof(uint64_t)
-        + sizeof(uint32_t)
-        + hash_size
-        + sizeof(uint32_t)
-        + sizeof(uint32_t);
+    data_chunk prefix(transaction::signature_midstate_size, 0);
+    const auto bytes = to_little_endian(version);
+    std::copy(bytes.begin(), bytes.end(), prefix.begin());
+    return sha256_midstate(prefix);
 }
 
 // private/static
@@ -763,12 +740,6 @@ hash_digest script::generate_version_0_signature_hash(const transaction& tx,
     // Unlike unversioned algorithm this does not allow an invalid input index.
     BITCOIN_ASSERT(input_index < tx.inputs().size());
     const auto& input = tx.inputs()[input_index];
-    const auto size = preimage_size(script_code.serialized_size(true));
-
-    data_chunk data;
-    data.reserve(size);
-    data_sink ostream(data);
-    ostream_writer sink(ostream);
 
     // Flags derived from the signature hash byte.
     const auto sighash = to_sighash_enum(sighash_type);
@@ -779,13 +750,20 @@ hash_digest script::generate_version_0_signature_hash(const transaction& tx,
     const auto all = (sighash == sighash_algorithm::all);
 
     // 1. transaction version (4-byte little endian).
-    sink.write_little_endian(tx.version());
-
     // 2. inpoints hash (32-byte hash).
-    sink.write_hash(!any ? tx.inpoints_hash() : null_hash);
-
     // 3. sequences hash (32-byte hash).
-    sink.write_hash(!any && all ? tx.sequences_hash() : null_hash);
+    // The first 64 bytes are shared by all inputs, so are cached as midstate.
+    const auto sequences = !any && all ? tx.sequences_hash() : null_hash;
+    const auto midstate = !any ? tx.signature_midstate(all) :
+        anyone_midstate(tx.version());
+
+    // The preimage following the first block is hashed as it is written.
+    sha256_writer sink(midstate, 1);
+
+    // Remainder of the sequences hash that follows the first block.
+    const auto offset = transaction::signature_midstate_size -
+        sizeof(uint32_t) - hash_size;
+    sink.write_bytes(sequences.data() + offset, hash_size - offset);
 
     // 4. outpoint (32-byte hash + 4-byte little endian).
     input.previous_output().to_data(sink);
@@ -802,7 +780,7 @@ hash_digest script::generate_version_0_signature_hash(const transaction& tx,
     // 8. outputs hash (32-byte hash).
     sink.write_hash(all ? tx.outputs_hash() :
         (single && input_index < tx.outputs().size() ?
-            bitcoin_hash(tx.outputs()[input_index].to_data()) : null_hash));
+            to_output(tx, input_index) : null_hash));
 
     // 9. transaction locktime (4-byte little endian).
     sink.write_little_endian(tx.locktime());
@@ -810,9 +788,7 @@ hash_digest script::generate_version_0_signature_hash(const transaction& tx,
     // 10. sighash type of the signature (4-byte [not 1] little endian).
     sink.write_4_bytes_little_endian(sighash_type);
 
-    ostream.flush();
-    BITCOIN_ASSERT(data.size() == size);
-    return bitcoin_hash(data);
+    return sink.bitcoin_digest();
 }
 
 // Signing (common).
@@ -841,7 +817,7 @@ hash_digest script::generate_signature_hash(const transaction& tx,
 
 // static
 bool script::check_signature(const ec_signature& signature,
-    uint8_t sighash_type, const data_chunk& public_key,
+    uint8_t sighash_type, const data_slice& public_key,
     const script& script_code, const transaction& tx, uint32_t input_index,
     script_version version, uint64_t value)
 {
@@ -852,8 +828,28 @@ bool script::check_signature(const ec_signature& signature,
     const auto sighash = chain::script::generate_signature_hash(tx,
         input_index, script_code, sighash_type, version, value);
 
+    return check_signature(signature, public_key, sighash);
+}
+
+// static
+bool script::check_signature(const ec_signature& signature,
+    const data_slice& public_key, const hash_digest& sighash)
+{
+    if (signature.empty() || public_key.empty())
+        return false;
+
+    // A signature verified previously (such as in the pool) is not repeated.
+    auto& cache = signature_cache::global();
+
+    if (cache.contains(sighash, public_key, signature))
+        return true;
+
     // Validate the EC signature.
-    return verify_signature(public_key, sighash, signature);
+    if (!verify_signature(public_key, sighash, signature))
+        return false;
+
+    cache.insert(sighash, public_key, signature);
+    return true;
 }
 
 // static
@@ -1314,8 +1310,7 @@ void script::find_and_delete_(const data_chunk& endorsement)
     const auto value = operation(endorsement, false).to_data();
 
     operation op;
-    data_source stream(bytes_);
-    istream_reader source(stream);
+    byte_reader source(bytes_);
     std::vector<data_chunk::iterator> found;
 
     // The exhaustion test handles stream end and op deserialization failure.
@@ -1421,7 +1416,7 @@ code script::verify(const transaction& tx, uint32_t input_index,
             return error::invalid_script_embed;
 
         // Embedded script must be at the top of the stack (bip16).
-        script embedded_script(input.pop(), false);
+        script embedded_script(to_chunk(input.pop()), false);
 
         program embedded(embedded_script, std::move(input), true);
         if ((ec = embedded.evaluate()))
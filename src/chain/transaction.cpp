@@ -43,6 +43,7 @@
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
 #include <bitcoin/system/utility/ostream_writer.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -93,11 +94,14 @@ void write(Sink& sink, const std::vector<Put>& puts, bool wire, bool witness)
 }
 
 // Input list must be pre-populated as it determines witness count.
-inline void read_witnesses(reader& source, input::list& inputs)
+template <class Source>
+void read_witnesses(Source& source, input::list& inputs)
 {
     const auto deserialize = [&](input& input)
     {
-        input.set_witness(witness::factory(source, true));
+        witness value;
+        value.from_data(source, true);
+        input.set_witness(std::move(value));
     };
 
     std::for_each(inputs.begin(), inputs.end(), deserialize);
@@ -122,19 +126,20 @@ transaction::transaction()
     version_(0),
     locktime_(0),
     inputs_{},
-    outputs_{}
+    outputs_{},
+    frozen_(false)
 {
 }
 
+// The moved cache remains consistent, as it derives from moved values.
 transaction::transaction(transaction&& other)
   : metadata(std::move(other.metadata)),
     version_(other.version_),
     locktime_(other.locktime_),
     inputs_(std::move(other.inputs_)),
     outputs_(std::move(other.outputs_)),
-    hash_(other.hash_cache()),
-    total_input_value_(other.total_input_value_cache()),
-    total_output_value_(other.total_output_value_cache())
+    cache_(std::move(other.cache_)),
+    frozen_(other.frozen_.exchange(false))
 {
 }
 
@@ -144,9 +149,8 @@ transaction::transaction(const transaction& other)
     locktime_(other.locktime_),
     inputs_(other.inputs_),
     outputs_(other.outputs_),
-    hash_(other.hash_cache()),
-    total_input_value_(other.total_input_value_cache()),
-    total_output_value_(other.total_output_value_cache())
+    cache_(other.cache_copy()),
+    frozen_(other.frozen_.load())
 {
 }
 
@@ -156,7 +160,8 @@ transaction::transaction(uint32_t version, uint32_t locktime,
     version_(version),
     locktime_(locktime),
     inputs_(std::move(inputs)),
-    outputs_(std::move(outputs))
+    outputs_(std::move(outputs)),
+    frozen_(false)
 {
 }
 
@@ -166,29 +171,16 @@ transaction::transaction(uint32_t version, uint32_t locktime,
     version_(version),
     locktime_(locktime),
     inputs_(inputs),
-    outputs_(outputs)
+    outputs_(outputs),
+    frozen_(false)
 {
 }
 
-// Private cache access for copy/move construction.
-transaction::hash_ptr transaction::hash_cache() const
+// Private cache access for copy construction.
+transaction::cache_ptr transaction::cache_copy() const
 {
     shared_lock lock(mutex_);
-    return hash_;
-}
-
-// Private cache access for copy/move construction.
-transaction::optional_value transaction::total_input_value_cache() const
-{
-    shared_lock lock(mutex_);
-    return total_input_value_;
-}
-
-// Private cache access for copy/move construction.
-transaction::optional_value transaction::total_output_value_cache() const
-{
-    shared_lock lock(mutex_);
-    return total_output_value_;
+    return cache_ ? cache_ptr(new cache(*cache_)) : nullptr;
 }
 
 // Operators.
@@ -196,9 +188,8 @@ transaction::optional_value transaction::total_output_value_cache() const
 
 transaction& transaction::operator=(transaction&& other)
 {
-    hash_ = other.hash_cache();
-    total_input_value_ = other.total_input_value_cache();
-    total_output_value_ = other.total_output_value_cache();
+    cache_ = std::move(other.cache_);
+    frozen_.store(other.frozen_.exchange(false));
     version_ = other.version_;
     locktime_ = other.locktime_;
     inputs_ = std::move(other.inputs_);
@@ -210,9 +201,8 @@ transaction& transaction::operator=(transaction&& other)
 // This can be expensive, try to avoid.
 transaction& transaction::operator=(const transaction& other)
 {
-    hash_ = other.hash_cache();
-    total_input_value_ = other.total_input_value_cache();
-    total_output_value_ = other.total_output_value_cache();
+    cache_ = other.cache_copy();
+    frozen_.store(other.frozen_.load());
     version_ = other.version_;
     locktime_ = other.locktime_;
     inputs_ = other.inputs_;
@@ -283,8 +273,8 @@ transaction transaction::factory(reader& source, const hash_digest& hash,
 
 bool transaction::from_data(const data_chunk& data, bool wire, bool witness)
 {
-    data_source istream(data);
-    return from_data(istream, wire, witness);
+    byte_reader source(data);
+    return from_data(source, wire, witness);
 }
 
 bool transaction::from_data(std::istream& stream, bool wire, bool witness)
@@ -293,8 +283,10 @@ bool transaction::from_data(std::istream& stream, bool wire, bool witness)
     return from_data(source, wire, witness);
 }
 
+// private
 // Witness is not used by outputs, just for template normalization.
-bool transaction::from_data(reader& source, bool wire, bool witness)
+template <class Source>
+bool transaction::deserialize(Source& source, bool wire, bool witness)
 {
     reset();
 
@@ -350,13 +342,23 @@ bool transaction::from_data(reader& source, bool wire, bool witness)
     return source;
 }
 
+bool transaction::from_data(reader& source, bool wire, bool witness)
+{
+    return deserialize(source, wire, witness);
+}
+
+bool transaction::from_data(byte_reader& source, bool wire, bool witness)
+{
+    return deserialize(source, wire, witness);
+}
+
 bool transaction::from_data(reader& source, hash_digest&& hash, bool wire,
     bool witness)
 {
     if (!from_data(source, wire, witness))
         return false;
 
-    hash_ = std::make_shared<hash_digest>(std::move(hash));
+    cache_values().hash = std::move(hash);
     return true;
 }
 
@@ -366,7 +368,7 @@ bool transaction::from_data(reader& source, const hash_digest& hash, bool wire,
     if (!from_data(source, wire, witness))
         return false;
 
-    hash_ = std::make_shared<hash_digest>(hash);
+    cache_values().hash = hash;
     return true;
 }
 
@@ -380,12 +382,6 @@ void transaction::reset()
     outputs_.clear();
     outputs_.shrink_to_fit();
     invalidate_cache();
-    outputs_hash_.reset();
-    inpoints_hash_.reset();
-    sequences_hash_.reset();
-    segregated_ = boost::none;
-    total_input_value_ = boost::none;
-    total_output_value_ = boost::none;
 }
 
 bool transaction::is_valid() const
@@ -549,18 +545,12 @@ void transaction::set_inputs(const input::list& value)
 {
     inputs_ = value;
     invalidate_cache();
-    inpoints_hash_.reset();
-    sequences_hash_.reset();
-    segregated_ = boost::none;
-    total_input_value_ = boost::none;
 }
 
 void transaction::set_inputs(input::list&& value)
 {
     inputs_ = std::move(value);
     invalidate_cache();
-    segregated_ = boost::none;
-    total_input_value_ = boost::none;
 }
 
 output::list& transaction::outputs()
@@ -577,15 +567,12 @@ void transaction::set_outputs(const output::list& value)
 {
     outputs_ = value;
     invalidate_cache();
-    outputs_hash_.reset();
-    total_output_value_ = boost::none;
 }
 
 void transaction::set_outputs(output::list&& value)
 {
     outputs_ = std::move(value);
     invalidate_cache();
-    total_output_value_ = boost::none;
 }
 
 // Cache.
@@ -596,132 +583,233 @@ void transaction::invalidate_cache() const
 {
     ///////////////////////////////////////////////////////////////////////////
     // Critical Section
-    hash_mutex_.lock_upgrade();
+    unique_lock lock(mutex_);
+
+    frozen_.store(false);
+    cache_.reset();
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// private
+// The caller must hold an exclusive lock or otherwise exclusive access.
+transaction::cache& transaction::cache_values() const
+{
+    if (!cache_)
+        cache_.reset(new cache);
+
+    return *cache_;
+}
 
-    if (hash_ || witness_hash_)
+// private
+// Values are computed outside of the lock, as computation may itself read
+// cached values, and the first value stored is retained. Once frozen a value
+// is read without locking, and if not populated by freeze is not cached.
+template <typename Value, typename Function>
+Value transaction::cached(boost::optional<Value> cache::* value,
+    Function compute) const
+{
+    if (frozen_.load(std::memory_order_acquire))
     {
-        hash_mutex_.unlock_upgrade_and_lock();
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_.reset();
-        witness_hash_.reset();
+        const auto& frozen = (*cache_).*value;
+        return frozen ? frozen.get() : compute();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    mutex_.lock_shared();
+
+    if (cache_ && (*cache_).*value)
+    {
+        const auto stored = ((*cache_).*value).get();
+        mutex_.unlock_shared();
         //---------------------------------------------------------------------
-        hash_mutex_.unlock_and_lock_upgrade();
+        return stored;
     }
 
-    hash_mutex_.unlock_upgrade();
+    mutex_.unlock_shared();
+    ///////////////////////////////////////////////////////////////////////////
+
+    const auto computed = compute();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(mutex_);
+
+    auto& stored = cache_values().*value;
+
+    if (!stored)
+        stored = computed;
+
+    return stored.get();
     ///////////////////////////////////////////////////////////////////////////
 }
 
 hash_digest transaction::hash(bool witness) const
 {
     // Witness hashing must be disabled for non-segregated txs.
-    witness &= is_segregated();
+    if (witness && is_segregated())
+    {
+        return cached(&cache::witness_hash, [this]() -> hash_digest
+        {
+            // Witness coinbase tx hash is assumed to be null_hash (bip141).
+            if (is_coinbase())
+                return null_hash;
 
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
+            sha256_writer sink;
+            to_data(sink, true, true);
+            return sink.bitcoin_digest();
+        });
+    }
+
+    return cached(&cache::hash, [this]()
+    {
+        sha256_writer sink;
+        to_data(sink, true, false);
+        return sink.bitcoin_digest();
+    });
+}
+
+// static
+hash_list transaction::hashes(const list& transactions, bool witness)
+{
+    hash_list out(transactions.size());
+    std::vector<size_t> pending;
+    data_stack serialized;
 
-    if (witness)
+    for (size_t index = 0; index < transactions.size(); ++index)
     {
-        if (!witness_hash_)
+        const auto& tx = transactions[index];
+        const auto segregated = witness && tx.is_segregated();
+        const auto value = segregated ? &cache::witness_hash : &cache::hash;
+
+        // Witness coinbase tx hash is assumed to be null_hash (bip141).
+        // A frozen transaction always has the requested hash cached.
+        if ((segregated && tx.is_coinbase()) || tx.is_frozen())
         {
-            //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-            hash_mutex_.unlock_upgrade_and_lock();
+            out[index] = tx.hash(segregated);
+            continue;
+        }
 
-            // Witness coinbase tx hash is assumed to be null_hash (bip141).
-            witness_hash_ = std::make_shared<hash_digest>(
-                is_coinbase() ? null_hash : bitcoin_hash(to_data(true, true)));
+        boost::optional<hash_digest> stored;
 
-            hash_mutex_.unlock_and_lock_upgrade();
-            //-----------------------------------------------------------------
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        {
+            shared_lock lock(tx.mutex_);
+
+            if (tx.cache_)
+                stored = (*tx.cache_).*value;
         }
-    }
-    else
-    {
-        if (!hash_)
+        ///////////////////////////////////////////////////////////////////////
+
+        if (stored)
         {
-            //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-            hash_mutex_.unlock_upgrade_and_lock();
-            hash_ = std::make_shared<hash_digest>(bitcoin_hash(to_data(true)));
-            hash_mutex_.unlock_and_lock_upgrade();
-            //-----------------------------------------------------------------
+            out[index] = stored.get();
+            continue;
         }
+
+        pending.push_back(index);
+        serialized.push_back(tx.to_data(true, segregated));
     }
 
-    const auto hash = witness ? *witness_hash_ : *hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    const std::vector<data_slice> slices(serialized.begin(), serialized.end());
+    const auto batch = bitcoin_hash_batch(slices);
 
-    return hash;
-}
+    for (size_t item = 0; item < pending.size(); ++item)
+    {
+        const auto& tx = transactions[pending[item]];
+        const auto value = witness && tx.is_segregated() ?
+            &cache::witness_hash : &cache::hash;
 
-hash_digest transaction::outputs_hash() const
-{
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
+        out[pending[item]] = batch[item];
 
-    if (!outputs_hash_)
-    {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_mutex_.unlock_upgrade_and_lock();
-        outputs_hash_ = std::make_shared<hash_digest>(
-            script::to_outputs(*this));
-        hash_mutex_.unlock_and_lock_upgrade();
-        //-----------------------------------------------------------------
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        unique_lock lock(tx.mutex_);
+
+        auto& stored = tx.cache_values().*value;
+
+        if (!stored)
+            stored = batch[item];
+        ///////////////////////////////////////////////////////////////////////
     }
 
-    const auto hash = *outputs_hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+    return out;
+}
 
-    return hash;
+hash_digest transaction::outputs_hash() const
+{
+    return cached(&cache::outputs_hash, [this]()
+    {
+        return script::to_outputs(*this);
+    });
 }
 
 hash_digest transaction::inpoints_hash() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
+    return cached(&cache::inpoints_hash, [this]()
+    {
+        return script::to_inpoints(*this);
+    });
+}
 
-    if (!inpoints_hash_)
+hash_digest transaction::sequences_hash() const
+{
+    return cached(&cache::sequences_hash, [this]()
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_mutex_.unlock_upgrade_and_lock();
-        inpoints_hash_ = std::make_shared<hash_digest>(
-            script::to_inpoints(*this));
-        hash_mutex_.unlock_and_lock_upgrade();
-        //-----------------------------------------------------------------
-    }
+        return script::to_sequences(*this);
+    });
+}
 
-    const auto hash = *inpoints_hash_;
-    hash_mutex_.unlock_upgrade();
-    ///////////////////////////////////////////////////////////////////////////
+sha256_state transaction::signature_midstate(bool all) const
+{
+    const auto value = all ? &cache::midstate_all : &cache::midstate;
 
-    return hash;
+    return cached(value, [this, all]()
+    {
+        const auto prefix = build_chunk(
+        {
+            to_little_endian(version_),
+            inpoints_hash(),
+            all ? sequences_hash() : null_hash
+        });
+
+        // The midstate is of the first block, which ends within the last hash.
+        return sha256_midstate(
+            { prefix.data(), prefix.data() + signature_midstate_size });
+    });
 }
 
-hash_digest transaction::sequences_hash() const
+// Segregated transactions also populate the values used by bip143.
+void transaction::freeze() const
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    hash_mutex_.lock_upgrade();
+    if (is_frozen())
+        return;
 
-    if (!sequences_hash_)
+    hash(false);
+    total_output_value();
+    const auto segregated = is_segregated();
+
+    if (segregated)
     {
-        //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-        hash_mutex_.unlock_upgrade_and_lock();
-        sequences_hash_ = std::make_shared<hash_digest>(
-            script::to_sequences(*this));
-        hash_mutex_.unlock_and_lock_upgrade();
-        //-----------------------------------------------------------------
+        hash(true);
+        outputs_hash();
+        signature_midstate(false);
+        signature_midstate(true);
     }
 
-    const auto hash = *sequences_hash_;
-    hash_mutex_.unlock_upgrade();
     ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    unique_lock lock(mutex_);
+
+    cache_values().segregated = segregated;
+    frozen_.store(true, std::memory_order_release);
+    ///////////////////////////////////////////////////////////////////////////
+}
 
-    return hash;
+bool transaction::is_frozen() const
+{
+    return frozen_.load(std::memory_order_acquire);
 }
 
 // Utilities.
@@ -739,8 +827,12 @@ void transaction::strip_witness()
     // Critical Section
     unique_lock lock(mutex_);
 
-    segregated_ = false;
     std::for_each(inputs_.begin(), inputs_.end(), strip);
+
+    auto& values = cache_values();
+    values.segregated = false;
+    values.witness_hash = boost::none;
+    frozen_.store(false);
     ///////////////////////////////////////////////////////////////////////////
 }
 
@@ -828,9 +920,9 @@ uint64_t transaction::total_input_value() const
     // Critical Section
     mutex_.lock_upgrade();
 
-    if (total_input_value_ != boost::none)
+    if (cache_ && cache_->total_input_value != boost::none)
     {
-        value = total_input_value_.get();
+        value = cache_->total_input_value.get();
         mutex_.unlock_upgrade();
         //---------------------------------------------------------------------
         return value;
@@ -850,7 +942,7 @@ uint64_t transaction::total_input_value() const
     };
 
     value = std::accumulate(inputs_.begin(), inputs_.end(), uint64_t(0), sum);
-    total_input_value_ = value;
+    cache_values().total_input_value = value;
     mutex_.unlock();
     ///////////////////////////////////////////////////////////////////////////
 
@@ -860,35 +952,17 @@ uint64_t transaction::total_input_value() const
 // Returns max_uint64 in case of overflow.
 uint64_t transaction::total_output_value() const
 {
-    uint64_t value;
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (total_output_value_ != boost::none)
-    {
-        value = total_output_value_.get();
-        mutex_.unlock_upgrade();
-        //---------------------------------------------------------------------
-        return value;
-    }
-
-    mutex_.unlock_upgrade_and_lock();
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-    ////static_assert(max_money() < max_uint64, "overflow sentinel invalid");
-    const auto sum = [](uint64_t total, const output& output)
+    return cached(&cache::total_output_value, [this]()
     {
-        return ceiling_add(total, output.value());
-    };
-
-    value = std::accumulate(outputs_.begin(), outputs_.end(), uint64_t(0), sum);
-    total_output_value_ = value;
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////////
+        ////static_assert(max_money() < max_uint64, "overflow sentinel invalid");
+        const auto sum = [](uint64_t total, const output& output)
+        {
+            return ceiling_add(total, output.value());
+        };
 
-    return value;
+        return std::accumulate(outputs_.begin(), outputs_.end(), uint64_t(0),
+            sum);
+    });
 }
 
 uint64_t transaction::fees() const
@@ -1034,24 +1108,12 @@ bool transaction::is_mature(size_t height) const
     return std::all_of(inputs_.begin(), inputs_.end(), mature);
 }
 
+// Witnesses may be set through the mutable inputs accessor, which does not
+// invalidate the cache, so this is computed unless frozen.
 bool transaction::is_segregated() const
 {
-    bool value;
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    mutex_.lock_upgrade();
-
-    if (segregated_ != boost::none)
-    {
-        value = segregated_.get();
-        mutex_.unlock_upgrade();
-        //---------------------------------------------------------------------
-        return value;
-    }
-
-    mutex_.unlock_upgrade_and_lock();
-    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    if (frozen_.load(std::memory_order_acquire) && cache_->segregated)
+        return cache_->segregated.get();
 
     const auto segregated = [](const input& input)
     {
@@ -1059,11 +1121,7 @@ bool transaction::is_segregated() const
     };
 
     // If no block tx is has witness data the commitment is optional (bip141).
-    value = std::any_of(inputs_.begin(), inputs_.end(), segregated);
-    mutex_.unlock();
-    ///////////////////////////////////////////////////////////////////////////
-
-    return value;
+    return std::any_of(inputs_.begin(), inputs_.end(), segregated);
 }
 
 // Coinbase transactions return success, to simplify iteration.
@@ -0,0 +1,417 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/transaction_view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+#include <bitcoin/system/utility/monotonic_arena.hpp>
+#include "wire_parser.hpp"
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Constructors.
+//-----------------------------------------------------------------------------
+
+transaction_view::transaction_view()
+  : buffer_(nullptr),
+    offset_(0),
+    size_(0),
+    body_(0),
+    body_size_(0),
+    segregated_(false)
+{
+}
+
+transaction_view::transaction_view(transaction_view&& other)
+  : buffer_(std::move(other.buffer_)),
+    offset_(other.offset_),
+    size_(other.size_),
+    body_(other.body_),
+    body_size_(other.body_size_),
+    segregated_(other.segregated_),
+    inputs_(std::move(other.inputs_)),
+    outputs_(std::move(other.outputs_))
+{
+}
+
+// Copy construction of the lists selects the free store allocator.
+transaction_view::transaction_view(const transaction_view& other)
+  : buffer_(other.buffer_),
+    offset_(other.offset_),
+    size_(other.size_),
+    body_(other.body_),
+    body_size_(other.body_size_),
+    segregated_(other.segregated_),
+    inputs_(other.inputs_),
+    outputs_(other.outputs_)
+{
+}
+
+// Operators.
+//-----------------------------------------------------------------------------
+
+transaction_view& transaction_view::operator=(transaction_view&& other)
+{
+    buffer_ = std::move(other.buffer_);
+    offset_ = other.offset_;
+    size_ = other.size_;
+    body_ = other.body_;
+    body_size_ = other.body_size_;
+    segregated_ = other.segregated_;
+    inputs_ = std::move(other.inputs_);
+    outputs_ = std::move(other.outputs_);
+    return *this;
+}
+
+// Copy assignment would retain this view's allocator, and so its arena, so
+// the lists are copy constructed and then moved (propagating the allocator).
+transaction_view& transaction_view::operator=(const transaction_view& other)
+{
+    buffer_ = other.buffer_;
+    offset_ = other.offset_;
+    size_ = other.size_;
+    body_ = other.body_;
+    body_size_ = other.body_size_;
+    segregated_ = other.segregated_;
+    inputs_ = input_list(other.inputs_);
+    outputs_ = output_list(other.outputs_);
+    return *this;
+}
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+// static
+transaction_view transaction_view::factory(data_chunk&& data)
+{
+    transaction_view instance;
+    instance.from_data(std::move(data));
+    return instance;
+}
+
+// static
+transaction_view transaction_view::factory(const buffer_ptr& buffer,
+    size_t offset)
+{
+    transaction_view instance;
+    instance.from_data(buffer, offset);
+    return instance;
+}
+
+bool transaction_view::from_data(data_chunk&& data)
+{
+    return from_data(std::make_shared<const data_chunk>(std::move(data)));
+}
+
+bool transaction_view::from_data(const buffer_ptr& buffer, size_t offset)
+{
+    return from_data(buffer, offset, nullptr);
+}
+
+// This follows transaction::from_data (wire), retaining only offsets.
+bool transaction_view::from_data(const buffer_ptr& buffer, size_t offset,
+    const monotonic_arena::ptr& arena)
+{
+    reset();
+
+    if (!buffer)
+        return false;
+
+    // Assignment replaces the allocators (propagated on move).
+    inputs_ = input_list(input_allocator(arena));
+    outputs_ = output_list(output_allocator(arena));
+
+    wire_parser source(*buffer, offset);
+    source.skip(sizeof(uint32_t));
+    body_ = source.position();
+    auto inputs = source.read_size_little_endian();
+
+    // Detect witness as no inputs (marker) and expected flag (bip144).
+    const auto marker = inputs == witness_marker &&
+        source.peek_byte() == witness_flag;
+
+    if (marker)
+    {
+        // Skip over the peeked witness flag.
+        source.skip(1);
+        body_ = source.position();
+        inputs = source.read_size_little_endian();
+    }
+
+    inputs_.resize(inputs);
+
+    for (auto& input: inputs_)
+    {
+        input.point = source.position();
+        source.skip(point::satoshi_fixed_size());
+        const auto script_size = source.read_size_little_endian();
+        input.script = source.position();
+        input.script_size = script_size;
+        source.skip(script_size);
+        source.skip(sizeof(uint32_t));
+        input.witness = input.script;
+        input.witness_size = 0;
+    }
+
+    outputs_.resize(source.read_size_little_endian());
+
+    for (auto& output: outputs_)
+    {
+        output.value = source.position();
+        source.skip(sizeof(uint64_t));
+        const auto script_size = source.read_size_little_endian();
+        output.script = source.position();
+        output.script_size = script_size;
+        source.skip(script_size);
+    }
+
+    body_size_ = source.position() - body_;
+
+    if (marker)
+    {
+        for (auto& input: inputs_)
+        {
+            input.witness = source.position();
+            const auto elements = source.read_size_little_endian();
+            segregated_ |= elements != 0;
+
+            for (size_t element = 0; element < elements; ++element)
+                source.skip(source.read_size_little_endian());
+
+            // An empty stack is reported as no witness.
+            input.witness_size = elements == 0 ? 0 :
+                source.position() - input.witness;
+        }
+    }
+
+    source.skip(sizeof(uint32_t));
+
+    if (!source.is_valid())
+    {
+        reset();
+        return false;
+    }
+
+    buffer_ = buffer;
+    offset_ = offset;
+    size_ = source.position() - offset;
+    return true;
+}
+
+// protected
+void transaction_view::reset()
+{
+    buffer_.reset();
+    offset_ = 0;
+    size_ = 0;
+    body_ = 0;
+    body_size_ = 0;
+    segregated_ = false;
+    inputs_.clear();
+    outputs_.clear();
+}
+
+bool transaction_view::is_valid() const
+{
+    return buffer_ != nullptr;
+}
+
+// Serialization.
+//-----------------------------------------------------------------------------
+
+data_slice transaction_view::data() const
+{
+    return { at(offset_), at(offset_ + size_) };
+}
+
+size_t transaction_view::serialized_size() const
+{
+    return size_;
+}
+
+transaction transaction_view::to_transaction(bool witness) const
+{
+    return transaction::factory(to_chunk(data()), true, witness);
+}
+
+// Properties.
+//-----------------------------------------------------------------------------
+
+// private
+const uint8_t* transaction_view::at(size_t offset) const
+{
+    return buffer_ ? buffer_->data() + offset : nullptr;
+}
+
+uint32_t transaction_view::version() const
+{
+    return is_valid() ? from_little_endian_unsafe<uint32_t>(at(offset_)) : 0;
+}
+
+uint32_t transaction_view::locktime() const
+{
+    return is_valid() ? from_little_endian_unsafe<uint32_t>(
+        at(offset_ + size_ - sizeof(uint32_t))) : 0;
+}
+
+size_t transaction_view::inputs_size() const
+{
+    return inputs_.size();
+}
+
+point transaction_view::previous_output(size_t input) const
+{
+    const auto offset = inputs_[input].point;
+    hash_digest hash;
+    std::copy_n(at(offset), hash_size, hash.begin());
+    const auto index = from_little_endian_unsafe<uint32_t>(
+        at(offset + hash_size));
+    return{ std::move(hash), index };
+}
+
+data_slice transaction_view::input_script(size_t input) const
+{
+    const auto& offsets = inputs_[input];
+    return { at(offsets.script), at(offsets.script + offsets.script_size) };
+}
+
+uint32_t transaction_view::sequence(size_t input) const
+{
+    const auto& offsets = inputs_[input];
+    return from_little_endian_unsafe<uint32_t>(
+        at(offsets.script + offsets.script_size));
+}
+
+data_slice transaction_view::witness(size_t input) const
+{
+    const auto& offsets = inputs_[input];
+    return { at(offsets.witness), at(offsets.witness + offsets.witness_size) };
+}
+
+size_t transaction_view::outputs_size() const
+{
+    return outputs_.size();
+}
+
+uint64_t transaction_view::output_value(size_t output) const
+{
+    return from_little_endian_unsafe<uint64_t>(at(outputs_[output].value));
+}
+
+data_slice transaction_view::output_script(size_t output) const
+{
+    const auto& offsets = outputs_[output];
+    return { at(offsets.script), at(offsets.script + offsets.script_size) };
+}
+
+// private
+// Without a witness marker the non-witness serialization is the buffer.
+bool transaction_view::is_contiguous() const
+{
+    return body_ + body_size_ + sizeof(uint32_t) == offset_ + size_;
+}
+
+// private
+data_chunk transaction_view::to_stripped() const
+{
+    const auto locktime = offset_ + size_ - sizeof(uint32_t);
+
+    return build_chunk(
+    {
+        { at(offset_), at(offset_ + sizeof(uint32_t)) },
+        { at(body_), at(body_ + body_size_) },
+        { at(locktime), at(locktime + sizeof(uint32_t)) }
+    });
+}
+
+hash_digest transaction_view::hash(bool witness) const
+{
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    if (witness && segregated_)
+        return is_coinbase() ? null_hash : bitcoin_hash(data());
+
+    return is_contiguous() ? bitcoin_hash(data()) :
+        bitcoin_hash(to_stripped());
+}
+
+// static
+hash_list transaction_view::hashes(const list& transactions, bool witness)
+{
+    data_stack stripped;
+    std::vector<data_slice> slices;
+    slices.reserve(transactions.size());
+
+    for (const auto& tx: transactions)
+    {
+        if ((witness && tx.segregated_) || tx.is_contiguous())
+        {
+            slices.push_back(tx.data());
+        }
+        else
+        {
+            stripped.push_back(tx.to_stripped());
+            slices.push_back(stripped.back());
+        }
+    }
+
+    auto out = bitcoin_hash_batch(slices);
+
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    for (size_t index = 0; witness && index < out.size(); ++index)
+        if (transactions[index].segregated_ &&
+            transactions[index].is_coinbase())
+            out[index] = null_hash;
+
+    return out;
+}
+
+// Validation.
+//-----------------------------------------------------------------------------
+
+bool transaction_view::is_coinbase() const
+{
+    return inputs_.size() == 1 && previous_output(0).is_null();
+}
+
+bool transaction_view::is_segregated() const
+{
+    return segregated_;
+}
+
+// static
+size_t transaction_view::offsets_size(size_t inputs, size_t outputs)
+{
+    return inputs * sizeof(input_offsets) + outputs * sizeof(output_offsets);
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
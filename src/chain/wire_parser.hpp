@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_WIRE_PARSER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_WIRE_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/**
+ * Bounds checked traversal of a wire serialization, for parsing of element
+ * offsets without copying. Once invalid all reads return zero.
+ */
+class wire_parser
+{
+public:
+    wire_parser(const data_chunk& data, size_t position)
+      : data_(data), position_(position), valid_(position <= data.size())
+    {
+    }
+
+    bool is_valid() const
+    {
+        return valid_;
+    }
+
+    size_t position() const
+    {
+        return position_;
+    }
+
+    size_t remaining() const
+    {
+        return valid_ ? data_.size() - position_ : 0;
+    }
+
+    void invalidate()
+    {
+        valid_ = false;
+    }
+
+    void skip(size_t size)
+    {
+        if (size > remaining())
+            valid_ = false;
+        else
+            position_ += size;
+    }
+
+    uint8_t peek_byte() const
+    {
+        return remaining() < 1 ? 0 : data_[position_];
+    }
+
+    template <typename Integer>
+    Integer read_little_endian()
+    {
+        if (remaining() < sizeof(Integer))
+        {
+            valid_ = false;
+            return 0;
+        }
+
+        const auto value = from_little_endian_unsafe<Integer>(
+            data_.begin() + position_);
+        position_ += sizeof(Integer);
+        return value;
+    }
+
+    uint64_t read_variable_little_endian()
+    {
+        const auto prefix = read_little_endian<uint8_t>();
+
+        switch (prefix)
+        {
+            case varint_eight_bytes:
+                return read_little_endian<uint64_t>();
+            case varint_four_bytes:
+                return read_little_endian<uint32_t>();
+            case varint_two_bytes:
+                return read_little_endian<uint16_t>();
+            default:
+                return prefix;
+        }
+    }
+
+    // Guard against potential for arbitrary memory allocation.
+    size_t read_size_little_endian()
+    {
+        const auto size = read_variable_little_endian();
+
+        if (size > max_block_size)
+            valid_ = false;
+
+        return valid_ ? static_cast<size_t>(size) : 0;
+    }
+
+private:
+    const data_chunk& data_;
+    size_t position_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
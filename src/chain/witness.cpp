@@ -141,8 +141,8 @@ witness witness::factory(reader& source, bool prefix)
 
 bool witness::from_data(const data_chunk& encoded, bool prefix)
 {
-    data_source istream(encoded);
-    return from_data(istream, prefix);
+    byte_reader source(encoded);
+    return from_data(source, prefix);
 }
 
 bool witness::from_data(std::istream& stream, bool prefix)
@@ -151,13 +151,15 @@ bool witness::from_data(std::istream& stream, bool prefix)
     return from_data(source, prefix);
 }
 
+// private
 // Prefixed data assumed valid here though caller may confirm with is_valid.
-bool witness::from_data(reader& source, bool prefix)
+template <class Source>
+bool witness::deserialize(Source& source, bool prefix)
 {
     reset();
     valid_ = true;
 
-    const auto read_element = [](reader& source)
+    const auto read_element = [](Source& source)
     {
         // Tokens encoded as variable integer prefixed byte array (bip144).
         const auto size = source.read_size_little_endian();
@@ -194,6 +196,16 @@ bool witness::from_data(reader& source, bool prefix)
     return source;
 }
 
+bool witness::from_data(reader& source, bool prefix)
+{
+    return deserialize(source, prefix);
+}
+
+bool witness::from_data(byte_reader& source, bool prefix)
+{
+    return deserialize(source, prefix);
+}
+
 // private/static
 size_t witness::serialized_size(const data_stack& stack)
 {
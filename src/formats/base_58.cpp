@@ -18,19 +18,68 @@
  */
 #include <bitcoin/system/formats/base_58.hpp>
 
-#include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include <bitcoin/system/utility/assert.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/string.hpp>
 
 namespace libbitcoin {
 namespace system {
 
-const std::string base58_chars =
+// The largest power of 58 that fits a 32 bit limb, and its digit count.
+static constexpr uint64_t limb_radix = 656356768;
+static constexpr size_t limb_digits = 5;
+
+// Intermediate limbs for inputs up to about 230 bytes stay on the stack.
+static constexpr size_t stack_limbs = 64;
+
+static constexpr uint8_t null = 255;
+static const char encode_table[] =
     "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+static const uint8_t decode_table[] =
+{
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, 0,    1,    2,    3,    4,    5,    6,
+    7,    8,    null, null, null, null, null, null,
+    null, 9,    10,   11,   12,   13,   14,   15,
+    16,   null, 17,   18,   19,   20,   21,   null,
+    22,   23,   24,   25,   26,   27,   28,   29,
+    30,   31,   32,   null, null, null, null, null,
+    null, 33,   34,   35,   36,   37,   38,   39,
+    40,   41,   42,   43,   null, 44,   45,   46,
+    47,   48,   49,   50,   51,   52,   53,   54,
+    55,   56,   57,   null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null,
+    null, null, null, null, null, null, null, null
+};
 
 bool is_base58(const char ch)
 {
-    // This works because the base58 characters happen to be in sorted order
-    return std::binary_search(base58_chars.begin(), base58_chars.end(), ch);
+    return decode_table[static_cast<uint8_t>(ch)] != null;
 }
 
 bool is_base58(const std::string& text)
@@ -43,154 +92,260 @@ bool is_base58(const std::string& text)
     return std::all_of(text.begin(), text.end(), test);
 }
 
-template <typename Data>
-auto search_first_nonzero(const Data& data) -> decltype(data.cbegin())
+// Encoding.
+// ----------------------------------------------------------------------------
+
+// Accumulate big-endian bytes into little-endian base 58^5 limbs, a word at a
+// time, returning the number of limbs used (the top limb is non-zero).
+static size_t to_base58_limbs(uint32_t* limbs, const uint8_t* begin,
+    const uint8_t* end)
 {
-    auto first_nonzero = data.cbegin();
-    while (first_nonzero != data.end() && *first_nonzero == 0)
-        ++first_nonzero;
+    size_t used = 0;
 
-    return first_nonzero;
-}
+    // Consume the leading remainder so that the rest is whole words.
+    auto take = static_cast<size_t>(end - begin) % sizeof(uint32_t);
+    if (take == 0)
+        take = sizeof(uint32_t);
 
-size_t count_leading_zeros(const data_slice& unencoded)
-{
-    // Skip and count leading '1's.
-    size_t leading_zeros = 0;
-    for (const uint8_t byte: unencoded)
+    while (begin != end)
     {
-        if (byte != 0)
-            break;
+        uint64_t carry = 0;
+        for (size_t byte = 0; byte < take; ++byte)
+            carry = (carry << 8) | *begin++;
 
-        ++leading_zeros;
+        // Apply "b58 = b58 * 256^take + word", limbs are < 2^30.
+        const uint64_t scale = uint64_t(1) << (8 * take);
+
+        for (size_t limb = 0; limb < used; ++limb)
+        {
+            carry += scale * limbs[limb];
+            limbs[limb] = static_cast<uint32_t>(carry % limb_radix);
+            carry /= limb_radix;
+        }
+
+        // The limb count is bounded by base58_encode_limbs.
+        for (; carry != 0; carry /= limb_radix)
+            limbs[used++] = static_cast<uint32_t>(carry % limb_radix);
+
+        take = sizeof(uint32_t);
     }
 
-    return leading_zeros;
+    return used;
 }
 
-void pack_value(data_chunk& indexes, size_t carry)
+static size_t count_leading_zeros(const uint8_t* begin, const uint8_t* end)
 {
-    // Apply "b58 = b58 * 256 + ch".
-    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it)
+    return std::find_if(begin, end, [](uint8_t byte) { return byte != 0; }) -
+        begin;
+}
+
+void encode_base58_private(std::string& out, uint32_t* limbs,
+    const uint8_t* in, size_t in_size)
+{
+    const auto end = in + in_size;
+    const auto zeros = count_leading_zeros(in, end);
+    const auto used = to_base58_limbs(limbs, in + zeros, end);
+
+    // The top limb has no leading zero digits.
+    size_t top_digits = 0;
+    for (auto value = used == 0 ? 0 : limbs[used - 1]; value != 0;
+        value /= 58)
+        ++top_digits;
+
+    // Leading zero bytes are represented by leading '1's.
+    out.resize(zeros + (used == 0 ? 0 : (used - 1) * limb_digits + top_digits));
+    std::fill_n(out.begin(), zeros, encode_table[0]);
+
+    // Write digits from the least significant, back to front.
+    auto digit = out.rbegin();
+    for (size_t limb = 0; limb < used; ++limb)
     {
-        carry += 256 * (*it);
-        *it = carry % 58;
-        carry /= 58;
-    }
+        auto value = limbs[limb];
+        const auto digits = limb + 1 == used ? top_digits : limb_digits;
 
-    BITCOIN_ASSERT(carry == 0);
+        for (size_t count = 0; count < digits; ++count, value /= 58)
+            *digit++ = encode_table[value % 58];
+    }
 }
 
 std::string encode_base58(const data_slice& unencoded)
 {
-    size_t leading_zeros = count_leading_zeros(unencoded);
+    std::string out;
+    encode_base58(out, unencoded);
+    return out;
+}
 
-    // size = log(256) / log(58), rounded up.
-    const size_t number_nonzero = unencoded.size() - leading_zeros;
-    const size_t indexes_size = number_nonzero * 138 / 100 + 1;
+void encode_base58(std::string& out, const data_slice& unencoded)
+{
+    const auto size = base58_encode_limbs(unencoded.size());
+    std::array<uint32_t, stack_limbs> stack;
+    std::vector<uint32_t> heap(size > stack_limbs ? size : 0);
+    const auto limbs = heap.empty() ? stack.data() : heap.data();
+    encode_base58_private(out, limbs, unencoded.data(), unencoded.size());
+}
 
-    // Allocate enough space in big-endian base58 representation.
-    data_chunk indexes(indexes_size);
+void encode_base58(string_list& out, const data_stack& unencoded)
+{
+    std::vector<uint32_t> limbs(stack_limbs);
+    out.resize(unencoded.size());
 
-    // Process the bytes.
-    for (auto it = unencoded.begin() + leading_zeros;
-        it != unencoded.end(); ++it)
+    for (size_t index = 0; index < unencoded.size(); ++index)
     {
-        pack_value(indexes, *it);
+        const auto& data = unencoded[index];
+        limbs.resize(std::max(limbs.size(), base58_encode_limbs(data.size())));
+        encode_base58_private(out[index], limbs.data(), data.data(),
+            data.size());
     }
+}
 
-    // Skip leading zeroes in base58 result.
-    auto first_nonzero = search_first_nonzero(indexes);
+// Decoding.
+// ----------------------------------------------------------------------------
+
+// Accumulate base58 digits into little-endian base 2^32 limbs, five digits at
+// a time. Returns false on an invalid character or if limbs_size is exceeded.
+static bool to_base256_limbs(size_t& used, uint32_t* limbs, size_t limbs_size,
+    const char* begin, const char* end)
+{
+    used = 0;
 
-    // Translate the result into a string.
-    std::string encoded;
-    const size_t estimated_size = leading_zeros +
-        (indexes.end() - first_nonzero);
-    encoded.reserve(estimated_size);
-    encoded.assign(leading_zeros, '1');
+    // Consume the leading remainder so that the rest is whole limbs.
+    auto take = static_cast<size_t>(end - begin) % limb_digits;
+    if (take == 0)
+        take = limb_digits;
 
-    // Set actual main bytes.
-    for (auto it = first_nonzero; it != indexes.end(); ++it)
+    while (begin != end)
     {
-        const size_t index = *it;
-        encoded += base58_chars[index];
+        uint64_t carry = 0;
+        uint64_t scale = 1;
+
+        for (size_t count = 0; count < take; ++count, scale *= 58)
+        {
+            const auto value = decode_table[static_cast<uint8_t>(*begin++)];
+            if (value == null)
+                return false;
+
+            carry = carry * 58 + value;
+        }
+
+        // Apply "b256 = b256 * 58^take + digits", scale is < 2^30.
+        for (size_t limb = 0; limb < used; ++limb)
+        {
+            carry += scale * limbs[limb];
+            limbs[limb] = static_cast<uint32_t>(carry);
+            carry >>= 32;
+        }
+
+        for (; carry != 0; carry >>= 32)
+        {
+            if (used == limbs_size)
+                return false;
+
+            limbs[used++] = static_cast<uint32_t>(carry);
+        }
+
+        take = limb_digits;
     }
 
-    return encoded;
+    return true;
 }
 
-size_t count_leading_zeros(const std::string& encoded)
+static size_t count_leading_zeros(const char* begin, const char* end)
 {
-    // Skip and count leading '1's.
-    size_t leading_zeros = 0;
-    for (const uint8_t digit: encoded)
+    return std::find_if(begin, end, [](char digit)
     {
-        if (digit != base58_chars[0])
-            break;
+        return digit != encode_table[0];
+    }) - begin;
+}
 
-        ++leading_zeros;
-    }
+// The number of bytes in the value, excluding leading zero bytes.
+static size_t count_bytes(const uint32_t* limbs, size_t used)
+{
+    size_t top_bytes = 0;
+    for (auto value = used == 0 ? 0 : limbs[used - 1]; value != 0;
+        value >>= 8)
+        ++top_bytes;
 
-    return leading_zeros;
+    return used == 0 ? 0 : (used - 1) * sizeof(uint32_t) + top_bytes;
 }
 
-void unpack_char(data_chunk& data, size_t carry)
+// Write the value big-endian, preceded by leading zero bytes, into size bytes.
+static void write_bytes(uint8_t* out, size_t size, size_t zeros,
+    const uint32_t* limbs, size_t used)
 {
-    for (auto it = data.rbegin(); it != data.rend(); it++)
+    std::fill_n(out, zeros, 0x00);
+    auto byte = out + size;
+
+    for (size_t limb = 0; limb < used; ++limb)
     {
-        carry += 58 * (*it);
-        *it = carry % 256;
-        carry /= 256;
+        auto value = limbs[limb];
+        const auto bytes = limb + 1 == used ? size - zeros -
+            limb * sizeof(uint32_t) : sizeof(uint32_t);
+
+        for (size_t count = 0; count < bytes; ++count, value >>= 8)
+            *--byte = static_cast<uint8_t>(value);
     }
+}
+
+// Decode into the caller's limbs, resizing out only once the input is valid.
+static bool decode_chunk(data_chunk& out, uint32_t* limbs,
+    size_t limbs_size, const std::string& in)
+{
+    const auto begin = in.data();
+    const auto end = begin + in.size();
+    const auto zeros = count_leading_zeros(begin, end);
+
+    size_t used;
+    if (!to_base256_limbs(used, limbs, limbs_size, begin + zeros, end))
+        return false;
 
-    BITCOIN_ASSERT(carry == 0);
+    out.resize(zeros + count_bytes(limbs, used));
+    write_bytes(out.data(), out.size(), zeros, limbs, used);
+    return true;
 }
 
 bool decode_base58(data_chunk& out, const std::string& in)
 {
-    // Trim spaces and newlines around the string.
-    const auto leading_zeros = count_leading_zeros(in);
-
     // log(58) / log(256), rounded up.
-    const size_t data_size = in.size() * 733 / 1000 + 1;
+    const auto size = base58_decode_limbs(in.size() * 733 / 1000 + 1);
+    std::array<uint32_t, stack_limbs> stack;
+    std::vector<uint32_t> heap(size > stack_limbs ? size : 0);
+    const auto limbs = heap.empty() ? stack.data() : heap.data();
+    return decode_chunk(out, limbs, size, in);
+}
 
-    // Allocate enough space in big-endian base256 representation.
-    data_chunk data(data_size);
+// Decoded into a local stack, so that out is unchanged if any is invalid.
+bool decode_base58(data_stack& out, const string_list& in)
+{
+    std::vector<uint32_t> limbs(stack_limbs);
+    data_stack decoded(in.size());
 
-    // Process the characters.
-    for (auto it = in.begin() + leading_zeros; it != in.end(); ++it)
+    for (size_t index = 0; index < in.size(); ++index)
     {
-        const auto carry = base58_chars.find(*it);
-        if (carry == std::string::npos)
-            return false;
+        const auto& text = in[index];
+        const auto size = base58_decode_limbs(text.size() * 733 / 1000 + 1);
+        limbs.resize(std::max(limbs.size(), size));
 
-        unpack_char(data, carry);
+        if (!decode_chunk(decoded[index], limbs.data(), size, text))
+            return false;
     }
 
-    // Skip leading zeroes in data.
-    auto first_nonzero = search_first_nonzero(data);
-
-    // Copy result into output vector.
-    data_chunk decoded;
-    const size_t estimated_size = leading_zeros + (data.end() - first_nonzero);
-    decoded.reserve(estimated_size);
-    decoded.assign(leading_zeros, 0x00);
-    decoded.insert(decoded.end(), first_nonzero, data.cend());
-
-    out = decoded;
+    decoded.swap(out);
     return true;
 }
 
 // For support of template implementation only, do not call directly.
-bool decode_base58_private(uint8_t* out, size_t out_size, const char* in)
+bool decode_base58_private(uint8_t* out, size_t out_size, uint32_t* limbs,
+    size_t limbs_size, const char* in, size_t in_size)
 {
-    data_chunk buffer;
-    if (!decode_base58(buffer, in) || buffer.size() != out_size)
-        return false;
+    const auto end = in + in_size;
+    const auto zeros = count_leading_zeros(in, end);
 
-    for (size_t i = 0; i < out_size; ++i)
-        out[i] = buffer[i];
+    size_t used;
+    if (!to_base256_limbs(used, limbs, limbs_size, in + zeros, end) ||
+        zeros + count_bytes(limbs, used) != out_size)
+        return false;
 
+    write_bytes(out, out_size, zeros, limbs, used);
     return true;
 }
 
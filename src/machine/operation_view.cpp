@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/operation_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/machine/opcode.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+// Deserialization.
+//-----------------------------------------------------------------------------
+
+// static
+operation_view::list operation_view::decode(const data_slice& encoded)
+{
+    const auto end = encoded.end();
+    auto position = encoded.begin();
+    auto valid = true;
+    size_t count = 0;
+
+    // Count first, so that the list is allocated exactly once.
+    while (position != end && (valid = next(position, end).is_valid()))
+        ++count;
+
+    list ops;
+    ops.reserve(valid ? count : count + 1);
+
+    // If an op fails it is pushed to operations and the loop terminates.
+    for (position = encoded.begin(); position != end;)
+    {
+        ops.push_back(next(position, end));
+
+        if (!ops.back().is_valid())
+            break;
+    }
+
+    return ops;
+}
+
+// private
+// This follows operation::from_data, referencing the data in place.
+operation_view operation_view::next(const uint8_t*& position,
+    const uint8_t* end)
+{
+    BC_CONSTEXPR auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
+
+    const auto code = static_cast<opcode>(*position++);
+    auto remaining = static_cast<size_t>(end - position);
+    uint32_t size;
+
+    switch (code)
+    {
+        case opcode::push_one_size:
+            if (remaining < sizeof(uint8_t))
+                return{};
+
+            size = *position;
+            position += sizeof(uint8_t);
+            break;
+        case opcode::push_two_size:
+            if (remaining < sizeof(uint16_t))
+                return{};
+
+            size = from_little_endian_unsafe<uint16_t>(position);
+            position += sizeof(uint16_t);
+            break;
+        case opcode::push_four_size:
+            if (remaining < sizeof(uint32_t))
+                return{};
+
+            size = from_little_endian_unsafe<uint32_t>(position);
+            position += sizeof(uint32_t);
+            break;
+        default:
+            const auto byte = static_cast<uint8_t>(code);
+            size = byte <= op_75 ? byte : 0;
+            break;
+    }
+
+    remaining = static_cast<size_t>(end - position);
+
+    if (size > max_block_size || size > remaining)
+        return{};
+
+    const auto data = size == 0 ? nullptr : position;
+    position += size;
+    return { code, data, size, true };
+}
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
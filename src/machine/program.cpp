@@ -56,10 +56,11 @@ program::program()
     input_index_(0),
     forks_(0),
     value_(0),
+    operations_(operation_view::decode(script_.encoded())),
     version_(script_version::unversioned),
     negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin())
+    jump_(operations_.begin())
 {
     reserve_stacks();
 }
@@ -70,10 +71,11 @@ program::program(const script& script)
     input_index_(0),
     forks_(0),
     value_(0),
+    operations_(operation_view::decode(script_.encoded())),
     version_(script_version::unversioned),
     negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin())
+    jump_(operations_.begin())
 {
     reserve_stacks();
 }
@@ -85,10 +87,11 @@ program::program(const script& script, const chain::transaction& transaction,
     input_index_(input_index),
     forks_(forks),
     value_(max_uint64),
+    operations_(operation_view::decode(script_.encoded())),
     version_(script_version::unversioned),
     negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin())
+    jump_(operations_.begin())
 {
     reserve_stacks();
 }
@@ -102,11 +105,12 @@ program::program(const script& script, const chain::transaction& transaction,
     input_index_(input_index),
     forks_(forks),
     value_(value),
+    operations_(operation_view::decode(script_.encoded())),
     version_(version),
     negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin()),
-    primary_(std::move(stack))
+    jump_(operations_.begin()),
+    primary_(stack.begin(), stack.end())
 {
     reserve_stacks();
 }
@@ -119,10 +123,11 @@ program::program(const script& script, const program& other)
     input_index_(other.input_index_),
     forks_(other.forks_),
     value_(other.value_),
+    operations_(operation_view::decode(script_.encoded())),
     version_(script_version::unversioned),
     negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin()),
+    jump_(operations_.begin()),
     primary_(other.primary_)
 {
     reserve_stacks();
@@ -135,10 +140,11 @@ program::program(const script& script, program&& other, bool)
     input_index_(other.input_index_),
     forks_(other.forks_),
     value_(other.value_),
+    operations_(operation_view::decode(script_.encoded())),
     version_(script_version::unversioned),
     negative_count_(0),
     operation_count_(0),
-    jump_(script_.begin()),
+    jump_(operations_.begin()),
     primary_(std::move(other.primary_))
 {
     reserve_stacks();
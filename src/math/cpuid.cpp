@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "cpuid.hpp"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+    #define CPUID_X86
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #elif defined(__GNUC__)
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace libbitcoin {
+namespace system {
+
+#ifdef CPUID_X86
+
+// cpuid leaf 1, ecx.
+static constexpr uint32_t sse41_bit = 1u << 19;
+static constexpr uint32_t xsave_bit = 1u << 27;
+static constexpr uint32_t avx_bit = 1u << 28;
+
+// cpuid leaf 7, ebx.
+static constexpr uint32_t avx2_bit = 1u << 5;
+static constexpr uint32_t bmi2_bit = 1u << 8;
+static constexpr uint32_t shani_bit = 1u << 29;
+
+// xcr0, sse and avx register state enabled by the operating system.
+static constexpr uint64_t ymm_state = 0x06;
+
+struct registers
+{
+    uint32_t eax;
+    uint32_t ebx;
+    uint32_t ecx;
+    uint32_t edx;
+};
+
+static registers cpuid(uint32_t leaf, uint32_t subleaf)
+{
+    registers out{ 0, 0, 0, 0 };
+
+#if defined(_MSC_VER)
+    int values[4];
+    __cpuid(values, 0);
+
+    if (static_cast<uint32_t>(values[0]) < leaf)
+        return out;
+
+    __cpuidex(values, leaf, subleaf);
+    out.eax = values[0];
+    out.ebx = values[1];
+    out.ecx = values[2];
+    out.edx = values[3];
+#else
+    if (__get_cpuid_max(0, nullptr) < leaf)
+        return out;
+
+    __cpuid_count(leaf, subleaf, out.eax, out.ebx, out.ecx, out.edx);
+#endif
+
+    return out;
+}
+
+static uint64_t xgetbv()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t low, high;
+    __asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+}
+
+static bool detect_avx()
+{
+    const auto ecx = cpuid(1, 0).ecx;
+    return ((ecx & xsave_bit) != 0) && ((ecx & avx_bit) != 0) &&
+        ((xgetbv() & ymm_state) == ymm_state);
+}
+
+bool have_sse41()
+{
+    static const auto value = (cpuid(1, 0).ecx & sse41_bit) != 0;
+    return value;
+}
+
+bool have_avx2()
+{
+    static const auto value = detect_avx() &&
+        ((cpuid(7, 0).ebx & (avx2_bit | bmi2_bit)) == (avx2_bit | bmi2_bit));
+    return value;
+}
+
+bool have_shani()
+{
+    static const auto value = have_sse41() &&
+        ((cpuid(7, 0).ebx & shani_bit) != 0);
+    return value;
+}
+
+#else
+
+bool have_sse41()
+{
+    return false;
+}
+
+bool have_avx2()
+{
+    return false;
+}
+
+bool have_shani()
+{
+    return false;
+}
+
+#endif
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CPUID_HPP
+#define LIBBITCOIN_SYSTEM_CPUID_HPP
+
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/**
+ * Processor feature detection for selection of vectorized implementations.
+ * Each query also verifies operating system support for the required register
+ * state and is false on platforms without x86 intrinsics support.
+ */
+bool have_sse41();
+bool have_avx2(); // with bmi2
+bool have_shani();
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
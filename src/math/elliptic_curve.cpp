@@ -19,14 +19,23 @@
 #include <bitcoin/system/math/elliptic_curve.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
 #include <utility>
+#include <vector>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <boost/ptr_container/ptr_vector.hpp>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/math/limits.hpp>
+#include <bitcoin/system/math/point_cache.hpp>
 #include <bitcoin/system/utility/assert.hpp>
 #include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/parallel_for.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
 #include <bitcoin/system/wallet/hd_private.hpp>
 #include "../math/external/lax_der_parsing.h"
 #include "secp256k1_initializer.hpp"
@@ -45,6 +54,31 @@ BC_CONSTFUNC int to_flags(bool compressed)
     return compressed ? SECP256K1_EC_COMPRESSED : SECP256K1_EC_UNCOMPRESSED;
 }
 
+// Parse a serialized point, consulting and filling the point cache.
+static bool parse_point(const secp256k1_context* context,
+    secp256k1_pubkey& out, const data_slice& point)
+{
+    static_assert(sizeof(out.data) == point_cache::parsed_point_size,
+        "unexpected parsed point size");
+
+    auto& cache = point_cache::global();
+    point_cache::parsed_point parsed;
+
+    if (cache.find(parsed, point))
+    {
+        std::copy(parsed.begin(), parsed.end(), std::begin(out.data));
+        return true;
+    }
+
+    if (secp256k1_ec_pubkey_parse(context, &out, point.data(),
+        point.size()) != 1)
+        return false;
+
+    std::copy_n(std::begin(out.data), parsed.size(), parsed.begin());
+    cache.insert(point, parsed);
+    return true;
+}
+
 // Helper templates
 // ----------------------------------------------------------------------------
 // These allow strong typing of private keys without redundant code.
@@ -53,7 +87,7 @@ template <size_t Size>
 bool parse(const secp256k1_context* context, secp256k1_pubkey& out,
     const byte_array<Size>& point)
 {
-    return secp256k1_ec_pubkey_parse(context, &out, point.data(), Size) == 1;
+    return parse_point(context, out, point);
 }
 
 template <size_t Size>
@@ -396,15 +430,113 @@ bool verify_signature(const data_slice& point, const hash_digest& hash,
     const auto context = verification.context();
     secp256k1_ecdsa_signature_normalize(context, &normal, &parsed);
 
-    // This uses a data slice and calls secp256k1_ec_pubkey_parse() in place of
-    // parse() so that we can support the der_verify data_chunk optimization.
+    // This uses a data slice and calls parse_point() in place of parse() so
+    // that we can support the der_verify data_chunk optimization.
     secp256k1_pubkey pubkey;
-    const auto size = point.size();
-    return
-        secp256k1_ec_pubkey_parse(context, &pubkey, point.data(), size) == 1 &&
+    return parse_point(context, pubkey, point) &&
         secp256k1_ecdsa_verify(context, &normal, hash.data(), &pubkey) == 1;
 }
 
+// Batch verify
+// ----------------------------------------------------------------------------
+
+// Each distinct point is parsed once, invalid points are not retained. The
+// verification context is not modified by verification, so it is shared by
+// all threads, and each result is written only by the thread that verifies it.
+class signature_verifier
+{
+public:
+    signature_verifier(const signature_verification::list& batch)
+      : batch_(batch), context_(verification.context()),
+        keys_(batch.size(), max_size_t), results_(batch.size(), 0)
+    {
+        parse();
+    }
+
+    size_t size() const
+    {
+        return batch_.size();
+    }
+
+    void verify(size_t index)
+    {
+        const auto key = keys_[index];
+        const auto& item = batch_[index];
+        results_[index] = key != max_size_t && verify_signature(context_,
+            points_[key], item.hash, item.signature) ? 1 : 0;
+    }
+
+    std::vector<bool> results() const
+    {
+        return { results_.begin(), results_.end() };
+    }
+
+private:
+    void parse()
+    {
+        std::vector<size_t> order(batch_.size());
+        std::iota(order.begin(), order.end(), size_t(0));
+
+        const auto less = [this](size_t left, size_t right)
+        {
+            return batch_[left].point < batch_[right].point;
+        };
+
+        std::sort(order.begin(), order.end(), less);
+
+        auto valid = false;
+        const data_chunk* previous = nullptr;
+
+        for (const auto index: order)
+        {
+            const auto& point = batch_[index].point;
+
+            if (previous == nullptr || point != *previous)
+            {
+                secp256k1_pubkey pubkey;
+                valid = parse_point(context_, pubkey, point);
+
+                if (valid)
+                    points_.push_back(pubkey);
+
+                previous = &point;
+            }
+
+            if (valid)
+                keys_[index] = points_.size() - 1;
+        }
+    }
+
+    const signature_verification::list& batch_;
+    const secp256k1_context* context_;
+    std::vector<secp256k1_pubkey> points_;
+    std::vector<size_t> keys_;
+    std::vector<uint8_t> results_;
+};
+
+std::vector<bool> verify_signatures(const signature_verification::list& batch)
+{
+    signature_verifier verifier(batch);
+
+    for (size_t index = 0; index < verifier.size(); ++index)
+        verifier.verify(index);
+
+    return verifier.results();
+}
+
+std::vector<bool> verify_signatures(const signature_verification::list& batch,
+    threadpool& pool)
+{
+    signature_verifier verifier(batch);
+    parallel_for(pool, verifier.size(), [&](size_t index)
+    {
+        verifier.verify(index);
+        return error::success;
+    });
+
+    return verifier.results();
+}
+
 // Recoverable sign/recover
 // ----------------------------------------------------------------------------
 
@@ -99,6 +99,8 @@ void SHA256Pad(SHA256CTX* context);
 void SHA256Transform(uint32_t state[SHA256_STATE_LENGTH],
     const uint8_t block[SHA256_BLOCK_LENGTH]);
 
+static SHA256Transformer transformer = SHA256TransformPortable;
+
 void SHA256_(const uint8_t* input, size_t length,
     uint8_t digest[SHA256_DIGEST_LENGTH])
 {
@@ -144,16 +146,16 @@ void SHA256Update(SHA256CTX* context, const uint8_t* input, size_t length)
     }
 
     memcpy(&context->buf[r], input, 64 - r);
-    SHA256Transform(context->state, context->buf);
+    transformer(context->state, context->buf, 1);
 
     input += 64 - r;
     length -= 64 - r;
 
-    while (length >= 64)
+    if (length >= 64)
     {
-        SHA256Transform(context->state, input);
-        input += 64;
-        length -= 64;
+        transformer(context->state, input, length / 64);
+        input += length & ~(size_t)63;
+        length &= 63;
     }
 
     memcpy(context->buf, input, length);
@@ -166,6 +168,26 @@ void SHA256Final(SHA256CTX* context, uint8_t digest[SHA256_DIGEST_LENGTH])
     zeroize((void*)context, sizeof *context);
 }
 
+SHA256Transformer SHA256GetTransformer(void)
+{
+    return transformer;
+}
+
+void SHA256SetTransformer(SHA256Transformer value)
+{
+    transformer = value;
+}
+
+void SHA256TransformPortable(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count)
+{
+    while (count-- > 0)
+    {
+        SHA256Transform(state, blocks);
+        blocks += SHA256_BLOCK_LENGTH;
+    }
+}
+
 /* Local */
 
 void SHA256Pad(SHA256CTX* context)
@@ -34,6 +34,13 @@
 #define SHA256_BLOCK_LENGTH 64U
 #define SHA256_DIGEST_LENGTH 32U
 
+/* The x86 compression functions are built with intrinsics (gcc, clang, msvc). */
+#if (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)) && (defined(__GNUC__) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1900))
+    #define SHA256_X86
+#endif
+
 #ifdef __cplusplus
 extern "C" 
 {
@@ -46,6 +53,10 @@ typedef struct SHA256CTX
     uint8_t buf[SHA256_BLOCK_LENGTH];
 } SHA256CTX;
 
+/* Compress count consecutive blocks into the state. */
+typedef void (*SHA256Transformer)(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+
 void SHA256_(const uint8_t* input, size_t length,
     uint8_t digest[SHA256_DIGEST_LENGTH]);
 
@@ -53,6 +64,36 @@ void SHA256Init(SHA256CTX* context);
 void SHA256Update(SHA256CTX* context, const uint8_t* input, size_t length);
 void SHA256Final(SHA256CTX* context, uint8_t digest[SHA256_DIGEST_LENGTH]);
 
+/* The transformer used by all of the above, portable by default. */
+/* Setting the transformer is not thread safe with respect to hashing. */
+SHA256Transformer SHA256GetTransformer(void);
+void SHA256SetTransformer(SHA256Transformer transformer);
+
+/* Compression functions, the x86 variants require cpu support. */
+void SHA256TransformPortable(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+
+#ifdef SHA256_X86
+void SHA256TransformSSE41(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+void SHA256TransformAVX2(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+void SHA256TransformSHANI(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count);
+
+/* Compress one block into each of N independent (lane) states, where the */
+/* states are word interleaved as state[word * N + lane]. */
+void SHA256TransformSSE41x4(uint32_t state[SHA256_STATE_LENGTH * 4],
+    const uint8_t* blocks[4]);
+void SHA256TransformAVX2x8(uint32_t state[SHA256_STATE_LENGTH * 8],
+    const uint8_t* blocks[8]);
+
+/* Double hash N consecutive 64 byte messages into N consecutive digests, */
+/* the digests may overlap the messages. */
+void SHA256DoubleSSE41x4(uint8_t* digests, const uint8_t* messages);
+void SHA256DoubleAVX2x8(uint8_t* digests, const uint8_t* messages);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
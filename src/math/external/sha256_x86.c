@@ -0,0 +1,613 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sha256.h"
+
+#ifdef SHA256_X86
+
+#include <stdint.h>
+#include <stddef.h>
+#include <immintrin.h>
+#include "zeroize.h"
+
+/* Each kernel is compiled for its instruction set independent of the build */
+/* flags, the caller is responsible for checking cpu support before use. */
+#if defined(_MSC_VER)
+    #define SHA256_TARGET(isa)
+    #define SHA256_INLINE static __forceinline
+#else
+    #define SHA256_TARGET(isa) __attribute__((target(isa)))
+    #define SHA256_INLINE static inline __attribute__((always_inline))
+#endif
+
+static const uint32_t K[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* Scalar rounds over a precomputed message schedule (W + K). */
+/* ------------------------------------------------------------------------- */
+
+#define Ch(x, y, z)  ((x & (y ^ z)) ^ z)
+#define Maj(x, y, z) ((x & (y | z)) | (y & z))
+#define ROTR(x, n)   ((x >> n) | (x << (32 - n)))
+#define S0(x)        (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define S1(x)        (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+
+#define RND(a, b, c, d, e, f, g, h, wk) \
+    t0 = h + S1(e) + Ch(e, f, g) + wk; \
+    t1 = S0(a) + Maj(a, b, c); \
+    d += t0; \
+    h = t0 + t1;
+
+/* Inlined so that rotates are emitted for the instruction set of the caller. */
+SHA256_INLINE void sha256_rounds(uint32_t state[SHA256_STATE_LENGTH],
+    const uint32_t wk[64])
+{
+    int i;
+    uint32_t t0, t1;
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (i = 0; i < 64; i += 8)
+    {
+        RND(a, b, c, d, e, f, g, h, wk[i + 0]);
+        RND(h, a, b, c, d, e, f, g, wk[i + 1]);
+        RND(g, h, a, b, c, d, e, f, wk[i + 2]);
+        RND(f, g, h, a, b, c, d, e, wk[i + 3]);
+        RND(e, f, g, h, a, b, c, d, wk[i + 4]);
+        RND(d, e, f, g, h, a, b, c, wk[i + 5]);
+        RND(c, d, e, f, g, h, a, b, wk[i + 6]);
+        RND(b, c, d, e, f, g, h, a, wk[i + 7]);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+/* SSE4.1: vectorized message schedule, four words at a time. */
+/* ------------------------------------------------------------------------- */
+
+#define BSWAP_MASK 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL
+
+#define SSE_ROTR(x, n) \
+    _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - n))
+#define SSE_s0(x) _mm_xor_si128(_mm_xor_si128(SSE_ROTR(x, 7), \
+    SSE_ROTR(x, 18)), _mm_srli_epi32(x, 3))
+#define SSE_s1(x) _mm_xor_si128(_mm_xor_si128(SSE_ROTR(x, 17), \
+    SSE_ROTR(x, 19)), _mm_srli_epi32(x, 10))
+
+SHA256_INLINE SHA256_TARGET("sse4.1")
+void sha256_schedule_sse(uint32_t wk[64], const uint8_t block[64])
+{
+    int t;
+    __m128i next;
+    const __m128i mask = _mm_set_epi64x(BSWAP_MASK);
+    const __m128i* in = (const __m128i*)block;
+    const __m128i* k = (const __m128i*)K;
+    __m128i* out = (__m128i*)wk;
+
+    __m128i x0 = _mm_shuffle_epi8(_mm_loadu_si128(in + 0), mask);
+    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128(in + 1), mask);
+    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128(in + 2), mask);
+    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128(in + 3), mask);
+
+    _mm_storeu_si128(out + 0, _mm_add_epi32(x0, _mm_loadu_si128(k + 0)));
+    _mm_storeu_si128(out + 1, _mm_add_epi32(x1, _mm_loadu_si128(k + 1)));
+    _mm_storeu_si128(out + 2, _mm_add_epi32(x2, _mm_loadu_si128(k + 2)));
+    _mm_storeu_si128(out + 3, _mm_add_epi32(x3, _mm_loadu_si128(k + 3)));
+
+    for (t = 4; t < 16; ++t)
+    {
+        /* w[t] = s1(w[t-2]) + w[t-7] + s0(w[t-15]) + w[t-16] */
+        next = _mm_add_epi32(x0, SSE_s0(_mm_alignr_epi8(x1, x0, 4)));
+        next = _mm_add_epi32(next, _mm_alignr_epi8(x3, x2, 4));
+
+        /* s1 depends on the two preceding words, so lanes 2-3 go second. */
+        next = _mm_add_epi32(next, SSE_s1(_mm_srli_si128(x3, 8)));
+        next = _mm_add_epi32(next, SSE_s1(_mm_slli_si128(next, 8)));
+
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+        x3 = next;
+        _mm_storeu_si128(out + t, _mm_add_epi32(next, _mm_loadu_si128(k + t)));
+    }
+}
+
+SHA256_TARGET("sse4.1")
+void SHA256TransformSSE41(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count)
+{
+    uint32_t wk[64];
+
+    for (; count > 0; --count, blocks += SHA256_BLOCK_LENGTH)
+    {
+        sha256_schedule_sse(wk, blocks);
+        sha256_rounds(state, wk);
+    }
+
+    zeroize((void*)wk, sizeof wk);
+}
+
+/* AVX2: schedules two blocks at once (one per 128 bit lane), BMI2 rounds. */
+/* ------------------------------------------------------------------------- */
+
+#define AVX_ROTR(x, n) \
+    _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n))
+#define AVX_s0(x) _mm256_xor_si256(_mm256_xor_si256(AVX_ROTR(x, 7), \
+    AVX_ROTR(x, 18)), _mm256_srli_epi32(x, 3))
+#define AVX_s1(x) _mm256_xor_si256(_mm256_xor_si256(AVX_ROTR(x, 17), \
+    AVX_ROTR(x, 19)), _mm256_srli_epi32(x, 10))
+
+#define AVX_LOAD(first, second, index) _mm256_shuffle_epi8( \
+    _mm256_inserti128_si256(_mm256_castsi128_si256( \
+        _mm_loadu_si128((const __m128i*)(first) + index)), \
+        _mm_loadu_si128((const __m128i*)(second) + index), 1), mask)
+
+#define AVX_STORE(first, second, index, value) \
+    _mm_storeu_si128((__m128i*)(first) + index, \
+        _mm256_castsi256_si128(value)); \
+    _mm_storeu_si128((__m128i*)(second) + index, \
+        _mm256_extracti128_si256(value, 1))
+
+SHA256_INLINE SHA256_TARGET("avx2")
+void sha256_schedule_avx2(uint32_t wk1[64], uint32_t wk2[64],
+    const uint8_t block1[64], const uint8_t block2[64])
+{
+    int t;
+    __m256i next, sum;
+    const __m256i mask = _mm256_broadcastsi128_si256(
+        _mm_set_epi64x(BSWAP_MASK));
+    const __m128i* k = (const __m128i*)K;
+
+    __m256i x0 = AVX_LOAD(block1, block2, 0);
+    __m256i x1 = AVX_LOAD(block1, block2, 1);
+    __m256i x2 = AVX_LOAD(block1, block2, 2);
+    __m256i x3 = AVX_LOAD(block1, block2, 3);
+
+    sum = _mm256_add_epi32(x0, _mm256_broadcastsi128_si256(_mm_loadu_si128(k + 0)));
+    AVX_STORE(wk1, wk2, 0, sum);
+    sum = _mm256_add_epi32(x1, _mm256_broadcastsi128_si256(_mm_loadu_si128(k + 1)));
+    AVX_STORE(wk1, wk2, 1, sum);
+    sum = _mm256_add_epi32(x2, _mm256_broadcastsi128_si256(_mm_loadu_si128(k + 2)));
+    AVX_STORE(wk1, wk2, 2, sum);
+    sum = _mm256_add_epi32(x3, _mm256_broadcastsi128_si256(_mm_loadu_si128(k + 3)));
+    AVX_STORE(wk1, wk2, 3, sum);
+
+    /* Byte shifts and alignment operate within each 128 bit lane. */
+    for (t = 4; t < 16; ++t)
+    {
+        next = _mm256_add_epi32(x0, AVX_s0(_mm256_alignr_epi8(x1, x0, 4)));
+        next = _mm256_add_epi32(next, _mm256_alignr_epi8(x3, x2, 4));
+        next = _mm256_add_epi32(next, AVX_s1(_mm256_srli_si256(x3, 8)));
+        next = _mm256_add_epi32(next, AVX_s1(_mm256_slli_si256(next, 8)));
+
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+        x3 = next;
+        sum = _mm256_add_epi32(next,
+            _mm256_broadcastsi128_si256(_mm_loadu_si128(k + t)));
+        AVX_STORE(wk1, wk2, t, sum);
+    }
+}
+
+SHA256_TARGET("avx2,bmi2")
+void SHA256TransformAVX2(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count)
+{
+    uint32_t wk1[64];
+    uint32_t wk2[64];
+    const int paired = count > 1;
+
+    for (; count > 1; count -= 2, blocks += 2 * SHA256_BLOCK_LENGTH)
+    {
+        sha256_schedule_avx2(wk1, wk2, blocks, blocks + SHA256_BLOCK_LENGTH);
+        sha256_rounds(state, wk1);
+        sha256_rounds(state, wk2);
+    }
+
+    if (count > 0)
+    {
+        sha256_schedule_sse(wk1, blocks);
+        sha256_rounds(state, wk1);
+    }
+
+    zeroize((void*)wk1, sizeof wk1);
+
+    if (paired)
+        zeroize((void*)wk2, sizeof wk2);
+}
+
+/* SHA-NI: native sha256 rounds and message schedule instructions. */
+/* ------------------------------------------------------------------------- */
+
+#define SHANI_K(index) _mm_loadu_si128((const __m128i*)K + index)
+
+/* Four rounds over m0 with the schedule advanced for the following rounds. */
+#define SHANI_QUAD(index, m0, m1, m2, m3, update, expand) \
+    message = _mm_add_epi32(m0, SHANI_K(index)); \
+    state1 = _mm_sha256rnds2_epu32(state1, state0, message); \
+    if (update) \
+    { \
+        temp = _mm_alignr_epi8(m0, m3, 4); \
+        m1 = _mm_sha256msg2_epu32(_mm_add_epi32(m1, temp), m0); \
+    } \
+    message = _mm_shuffle_epi32(message, 0x0e); \
+    state0 = _mm_sha256rnds2_epu32(state0, state1, message); \
+    if (expand) \
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+
+SHA256_TARGET("sha,sse4.1")
+void SHA256TransformSHANI(uint32_t state[SHA256_STATE_LENGTH],
+    const uint8_t* blocks, size_t count)
+{
+    __m128i state0, state1, message, temp;
+    __m128i m0, m1, m2, m3;
+    __m128i abef, cdgh;
+    const __m128i mask = _mm_set_epi64x(BSWAP_MASK);
+
+    /* Reorder the state words as expected by sha256rnds2. */
+    temp = _mm_loadu_si128((const __m128i*)&state[0]);
+    state1 = _mm_loadu_si128((const __m128i*)&state[4]);
+    temp = _mm_shuffle_epi32(temp, 0xb1);
+    state1 = _mm_shuffle_epi32(state1, 0x1b);
+    state0 = _mm_alignr_epi8(temp, state1, 8);
+    state1 = _mm_blend_epi16(state1, temp, 0xf0);
+
+    for (; count > 0; --count, blocks += SHA256_BLOCK_LENGTH)
+    {
+        abef = state0;
+        cdgh = state1;
+
+        m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)blocks + 0), mask);
+        m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)blocks + 1), mask);
+        m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)blocks + 2), mask);
+        m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)blocks + 3), mask);
+
+        SHANI_QUAD(0, m0, m1, m2, m3, 0, 0);
+        SHANI_QUAD(1, m1, m2, m3, m0, 0, 1);
+        SHANI_QUAD(2, m2, m3, m0, m1, 0, 1);
+        SHANI_QUAD(3, m3, m0, m1, m2, 1, 1);
+        SHANI_QUAD(4, m0, m1, m2, m3, 1, 1);
+        SHANI_QUAD(5, m1, m2, m3, m0, 1, 1);
+        SHANI_QUAD(6, m2, m3, m0, m1, 1, 1);
+        SHANI_QUAD(7, m3, m0, m1, m2, 1, 1);
+        SHANI_QUAD(8, m0, m1, m2, m3, 1, 1);
+        SHANI_QUAD(9, m1, m2, m3, m0, 1, 1);
+        SHANI_QUAD(10, m2, m3, m0, m1, 1, 1);
+        SHANI_QUAD(11, m3, m0, m1, m2, 1, 1);
+        SHANI_QUAD(12, m0, m1, m2, m3, 1, 1);
+        SHANI_QUAD(13, m1, m2, m3, m0, 1, 0);
+        SHANI_QUAD(14, m2, m3, m0, m1, 1, 0);
+        SHANI_QUAD(15, m3, m0, m1, m2, 0, 0);
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    /* Restore the state word order. */
+    temp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(temp, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, temp, 8);
+
+    _mm_storeu_si128((__m128i*)&state[0], state0);
+    _mm_storeu_si128((__m128i*)&state[4], state1);
+}
+
+
+/* Multiple lanes: independent messages in each 32 bit lane of a vector. */
+/* ------------------------------------------------------------------------- */
+
+/* The initial state. */
+static const uint32_t IV[SHA256_STATE_LENGTH] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/* The schedule (W + K) of the padding block of a 64 byte message. */
+static const uint32_t PAD64[64] =
+{
+    0xc28a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf374,
+    0x649b69c1, 0xf0fe4786, 0x0fe1edc6, 0x240cf254,
+    0x4fe9346f, 0x6cc984be, 0x61b9411e, 0x16f988fa,
+    0xf2c65152, 0xa88e5a6d, 0xb019fc65, 0xb9d99ec7,
+    0x9a1231c3, 0xe70eeaa0, 0xfdb1232b, 0xc7353eb0,
+    0x3069bad5, 0xcb976d5f, 0x5a0f118f, 0xdc1eeefd,
+    0x0a35b689, 0xde0b7a04, 0x58f4ca9d, 0xe15d5b16,
+    0x007f3e86, 0x37088980, 0xa507ea32, 0x6fab9537,
+    0x17406110, 0x0d8cd6f1, 0xcdaa3b6d, 0xc0bbbe37,
+    0x83613bda, 0xdb48a363, 0x0b02e931, 0x6fd15ca7,
+    0x521afaca, 0x31338431, 0x6ed41a95, 0x6d437890,
+    0xc39c91f2, 0x9eccabbd, 0xb5c9a0e6, 0x532fb63c,
+    0xd2c741c6, 0x07237ea3, 0xa4954b68, 0x4c191d76
+};
+
+static uint32_t load_be32(const uint8_t* p)
+{
+    return ((uint32_t)(p[3]) + ((uint32_t)(p[2]) << 8) +
+        ((uint32_t)(p[1]) << 16) + ((uint32_t)(p[0]) << 24));
+}
+
+static void store_be32(uint8_t* p, uint32_t x)
+{
+    p[3] = x & 0xff;
+    p[2] = (x >> 8) & 0xff;
+    p[1] = (x >> 16) & 0xff;
+    p[0] = (x >> 24) & 0xff;
+}
+
+/* The lane kernels are written once against these vector operations. */
+#define L_ROTR(x, n) L_OR(L_SHR(x, n), L_SHL(x, 32 - n))
+#define L_S0(x) L_XOR(L_XOR(L_ROTR(x, 2), L_ROTR(x, 13)), L_ROTR(x, 22))
+#define L_S1(x) L_XOR(L_XOR(L_ROTR(x, 6), L_ROTR(x, 11)), L_ROTR(x, 25))
+#define L_s0(x) L_XOR(L_XOR(L_ROTR(x, 7), L_ROTR(x, 18)), L_SHR(x, 3))
+#define L_s1(x) L_XOR(L_XOR(L_ROTR(x, 17), L_ROTR(x, 19)), L_SHR(x, 10))
+#define L_Ch(x, y, z) L_XOR(z, L_AND(x, L_XOR(y, z)))
+#define L_Maj(x, y, z) L_OR(L_AND(x, y), L_AND(z, L_OR(x, y)))
+
+#define L_RND(a, b, c, d, e, f, g, h, wk) \
+    t1 = L_ADD(L_ADD(h, L_S1(e)), L_ADD(L_Ch(e, f, g), wk)); \
+    t2 = L_ADD(L_S0(a), L_Maj(a, b, c)); \
+    d = L_ADD(d, t1); \
+    h = L_ADD(t1, t2);
+
+/* Round i + j, the schedule is expanded in place after the first sixteen. */
+#define L_RNDW(a, b, c, d, e, f, g, h, j) \
+    if (i != 0) \
+        w[j] = L_ADD(L_ADD(w[j], L_s1(w[(j + 14) & 15])), \
+            L_ADD(w[(j + 9) & 15], L_s0(w[(j + 1) & 15]))); \
+    L_RND(a, b, c, d, e, f, g, h, L_ADD(L_SET1(K[i + j]), w[j]))
+
+#define L_ROUNDS \
+    for (i = 0; i < 64; i += 16) \
+    { \
+        L_RNDW(a, b, c, d, e, f, g, h, 0); \
+        L_RNDW(h, a, b, c, d, e, f, g, 1); \
+        L_RNDW(g, h, a, b, c, d, e, f, 2); \
+        L_RNDW(f, g, h, a, b, c, d, e, 3); \
+        L_RNDW(e, f, g, h, a, b, c, d, 4); \
+        L_RNDW(d, e, f, g, h, a, b, c, 5); \
+        L_RNDW(c, d, e, f, g, h, a, b, 6); \
+        L_RNDW(b, c, d, e, f, g, h, a, 7); \
+        L_RNDW(a, b, c, d, e, f, g, h, 8); \
+        L_RNDW(h, a, b, c, d, e, f, g, 9); \
+        L_RNDW(g, h, a, b, c, d, e, f, 10); \
+        L_RNDW(f, g, h, a, b, c, d, e, 11); \
+        L_RNDW(e, f, g, h, a, b, c, d, 12); \
+        L_RNDW(d, e, f, g, h, a, b, c, 13); \
+        L_RNDW(c, d, e, f, g, h, a, b, 14); \
+        L_RNDW(b, c, d, e, f, g, h, a, 15); \
+    }
+
+/* Rounds over the constant schedule of a 64 byte message padding block. */
+#define L_ROUNDS_PAD64 \
+    for (i = 0; i < 64; i += 8) \
+    { \
+        L_RND(a, b, c, d, e, f, g, h, L_SET1(PAD64[i + 0])); \
+        L_RND(h, a, b, c, d, e, f, g, L_SET1(PAD64[i + 1])); \
+        L_RND(g, h, a, b, c, d, e, f, L_SET1(PAD64[i + 2])); \
+        L_RND(f, g, h, a, b, c, d, e, L_SET1(PAD64[i + 3])); \
+        L_RND(e, f, g, h, a, b, c, d, L_SET1(PAD64[i + 4])); \
+        L_RND(d, e, f, g, h, a, b, c, L_SET1(PAD64[i + 5])); \
+        L_RND(c, d, e, f, g, h, a, b, L_SET1(PAD64[i + 6])); \
+        L_RND(b, c, d, e, f, g, h, a, L_SET1(PAD64[i + 7])); \
+    }
+
+#define L_LOAD_STATE(s) \
+    a = s[0]; b = s[1]; c = s[2]; d = s[3]; \
+    e = s[4]; f = s[5]; g = s[6]; h = s[7];
+
+#define L_ADD_STATE(s) \
+    s[0] = L_ADD(s[0], a); s[1] = L_ADD(s[1], b); \
+    s[2] = L_ADD(s[2], c); s[3] = L_ADD(s[3], d); \
+    s[4] = L_ADD(s[4], e); s[5] = L_ADD(s[5], f); \
+    s[6] = L_ADD(s[6], g); s[7] = L_ADD(s[7], h);
+
+/* The second hash of a double hash, the message is the first digest. */
+#define L_DOUBLE_SECOND(s) \
+    for (i = 0; i < 8; ++i) \
+    { \
+        w[i] = s[i]; \
+        s[i] = L_SET1(IV[i]); \
+    } \
+    w[8] = L_SET1(0x80000000); \
+    for (i = 9; i < 15; ++i) \
+        w[i] = L_SET1(0); \
+    w[15] = L_SET1(256); \
+    L_LOAD_STATE(s); \
+    L_ROUNDS; \
+    L_ADD_STATE(s);
+
+/* SSE4.1 four lanes. */
+
+#define L_ADD(x, y) _mm_add_epi32(x, y)
+#define L_AND(x, y) _mm_and_si128(x, y)
+#define L_OR(x, y) _mm_or_si128(x, y)
+#define L_XOR(x, y) _mm_xor_si128(x, y)
+#define L_SHR(x, n) _mm_srli_epi32(x, n)
+#define L_SHL(x, n) _mm_slli_epi32(x, n)
+#define L_SET1(x) _mm_set1_epi32((int)(x))
+
+#define X4_LOAD(p0, p1, p2, p3, offset) _mm_set_epi32( \
+    (int)load_be32((p3) + (offset)), (int)load_be32((p2) + (offset)), \
+    (int)load_be32((p1) + (offset)), (int)load_be32((p0) + (offset)))
+
+SHA256_TARGET("sse4.1")
+void SHA256TransformSSE41x4(uint32_t state[SHA256_STATE_LENGTH * 4],
+    const uint8_t* blocks[4])
+{
+    int i;
+    __m128i a, b, c, d, e, f, g, h, t1, t2;
+    __m128i s[8], w[16];
+
+    for (i = 0; i < 8; ++i)
+        s[i] = _mm_loadu_si128((const __m128i*)state + i);
+
+    for (i = 0; i < 16; ++i)
+        w[i] = X4_LOAD(blocks[0], blocks[1], blocks[2], blocks[3], 4 * i);
+
+    L_LOAD_STATE(s);
+    L_ROUNDS;
+    L_ADD_STATE(s);
+
+    for (i = 0; i < 8; ++i)
+        _mm_storeu_si128((__m128i*)state + i, s[i]);
+}
+
+SHA256_TARGET("sse4.1")
+void SHA256DoubleSSE41x4(uint8_t* digests, const uint8_t* messages)
+{
+    int i, lane;
+    __m128i a, b, c, d, e, f, g, h, t1, t2;
+    __m128i s[8], w[16];
+    uint32_t words[4];
+
+    for (i = 0; i < 16; ++i)
+        w[i] = X4_LOAD(messages, messages + 64, messages + 128,
+            messages + 192, 4 * i);
+
+    for (i = 0; i < 8; ++i)
+        s[i] = L_SET1(IV[i]);
+
+    L_LOAD_STATE(s);
+    L_ROUNDS;
+    L_ADD_STATE(s);
+    L_LOAD_STATE(s);
+    L_ROUNDS_PAD64;
+    L_ADD_STATE(s);
+    L_DOUBLE_SECOND(s);
+
+    for (i = 0; i < 8; ++i)
+    {
+        _mm_storeu_si128((__m128i*)words, s[i]);
+        for (lane = 0; lane < 4; ++lane)
+            store_be32(digests + lane * SHA256_DIGEST_LENGTH + 4 * i,
+                words[lane]);
+    }
+}
+
+#undef L_ADD
+#undef L_AND
+#undef L_OR
+#undef L_XOR
+#undef L_SHR
+#undef L_SHL
+#undef L_SET1
+
+/* AVX2 eight lanes. */
+
+#define L_ADD(x, y) _mm256_add_epi32(x, y)
+#define L_AND(x, y) _mm256_and_si256(x, y)
+#define L_OR(x, y) _mm256_or_si256(x, y)
+#define L_XOR(x, y) _mm256_xor_si256(x, y)
+#define L_SHR(x, n) _mm256_srli_epi32(x, n)
+#define L_SHL(x, n) _mm256_slli_epi32(x, n)
+#define L_SET1(x) _mm256_set1_epi32((int)(x))
+
+#define X8_LOAD(p, offset) _mm256_set_epi32( \
+    (int)load_be32((p)[7] + (offset)), (int)load_be32((p)[6] + (offset)), \
+    (int)load_be32((p)[5] + (offset)), (int)load_be32((p)[4] + (offset)), \
+    (int)load_be32((p)[3] + (offset)), (int)load_be32((p)[2] + (offset)), \
+    (int)load_be32((p)[1] + (offset)), (int)load_be32((p)[0] + (offset)))
+
+SHA256_TARGET("avx2")
+void SHA256TransformAVX2x8(uint32_t state[SHA256_STATE_LENGTH * 8],
+    const uint8_t* blocks[8])
+{
+    int i;
+    __m256i a, b, c, d, e, f, g, h, t1, t2;
+    __m256i s[8], w[16];
+
+    for (i = 0; i < 8; ++i)
+        s[i] = _mm256_loadu_si256((const __m256i*)state + i);
+
+    for (i = 0; i < 16; ++i)
+        w[i] = X8_LOAD(blocks, 4 * i);
+
+    L_LOAD_STATE(s);
+    L_ROUNDS;
+    L_ADD_STATE(s);
+
+    for (i = 0; i < 8; ++i)
+        _mm256_storeu_si256((__m256i*)state + i, s[i]);
+}
+
+SHA256_TARGET("avx2")
+void SHA256DoubleAVX2x8(uint8_t* digests, const uint8_t* messages)
+{
+    int i, lane;
+    __m256i a, b, c, d, e, f, g, h, t1, t2;
+    __m256i s[8], w[16];
+    uint32_t words[8];
+    const uint8_t* blocks[8];
+
+    for (lane = 0; lane < 8; ++lane)
+        blocks[lane] = messages + lane * SHA256_BLOCK_LENGTH;
+
+    for (i = 0; i < 16; ++i)
+        w[i] = X8_LOAD(blocks, 4 * i);
+
+    for (i = 0; i < 8; ++i)
+        s[i] = L_SET1(IV[i]);
+
+    L_LOAD_STATE(s);
+    L_ROUNDS;
+    L_ADD_STATE(s);
+    L_LOAD_STATE(s);
+    L_ROUNDS_PAD64;
+    L_ADD_STATE(s);
+    L_DOUBLE_SECOND(s);
+
+    for (i = 0; i < 8; ++i)
+    {
+        _mm256_storeu_si256((__m256i*)words, s[i]);
+        for (lane = 0; lane < 8; ++lane)
+            store_be32(digests + lane * SHA256_DIGEST_LENGTH + 4 * i,
+                words[lane]);
+    }
+}
+
+#endif
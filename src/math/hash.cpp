@@ -24,6 +24,9 @@
 #include <errno.h>
 #include <new>
 #include <stdexcept>
+#include <vector>
+#include <bitcoin/system/utility/assert.hpp>
+#include "../math/cpuid.hpp"
 #include "../math/external/crypto_scrypt.h"
 #include "../math/external/hmac_sha256.h"
 #include "../math/external/hmac_sha512.h"
@@ -41,6 +44,233 @@ hash_digest bitcoin_hash(const data_slice& data)
     return sha256_hash(sha256_hash(data));
 }
 
+// Multiple lane hashing.
+// ----------------------------------------------------------------------------
+
+typedef void(*sha256_lanes_transformer)(uint32_t* state,
+    const uint8_t** blocks);
+
+static BC_CONSTEXPR size_t sha256_max_lanes = 8;
+
+// The remaining blocks of the message hashing in a lane.
+struct sha256_lane
+{
+    size_t message;
+    const uint8_t* next;
+    size_t blocks;
+    const uint8_t* padding;
+    size_t pads;
+    uint8_t pad[2 * SHA256_BLOCK_LENGTH];
+};
+
+// Multiple lanes are used unless the portable backend is selected.
+static size_t sha256_lanes()
+{
+#ifdef SHA256_X86
+    switch (get_sha256_backend())
+    {
+        case sha256_backend::shani:
+        case sha256_backend::avx2:
+            return have_avx2() ? 8 : 4;
+        case sha256_backend::sse41:
+            return 4;
+        default:
+            return 1;
+    }
+#else
+    return 1;
+#endif
+}
+
+static void sha256_digest(hash_digest& out, const uint32_t* state,
+    size_t stride)
+{
+    for (size_t word = 0; word < SHA256_STATE_LENGTH; ++word)
+    {
+        const auto bytes = to_big_endian(state[word * stride]);
+        std::copy(bytes.begin(), bytes.end(), out.begin() + word * 4u);
+    }
+}
+
+// Hash one message per lane, refilling lanes as messages complete. Once the
+// messages are exhausted and no more than half of the lanes remain active the
+// remaining lanes are completed individually by the selected backend.
+static void sha256_lanes(hash_list& out, const std::vector<data_slice>& in,
+    size_t lanes, sha256_lanes_transformer transform)
+{
+    static const uint8_t idle[SHA256_BLOCK_LENGTH] = { 0 };
+    uint32_t state[SHA256_STATE_LENGTH * sha256_max_lanes];
+    const uint8_t* blocks[sha256_max_lanes];
+    sha256_lane lane[sha256_max_lanes];
+    size_t next = 0;
+    size_t active = 0;
+
+    SHA256CTX initial;
+    SHA256Init(&initial);
+
+    const auto start = [&](size_t column)
+    {
+        auto& it = lane[column];
+        const auto& message = in[next];
+        const uint64_t bits = message.size() * 8u;
+        const auto tail = message.size() % SHA256_BLOCK_LENGTH;
+
+        it.message = next++;
+        it.next = message.data();
+        it.blocks = message.size() / SHA256_BLOCK_LENGTH;
+        it.pads = tail < SHA256_BLOCK_LENGTH - sizeof(bits) ? 1 : 2;
+        it.padding = it.pad;
+
+        // The message tail, 0x80, zeros, and the big endian bit length.
+        const auto end = it.pad + it.pads * SHA256_BLOCK_LENGTH;
+        std::fill(it.pad, end, 0x00);
+        std::copy_n(message.data() + it.blocks * SHA256_BLOCK_LENGTH, tail,
+            it.pad);
+        it.pad[tail] = 0x80;
+        const auto length = to_big_endian(bits);
+        std::copy(length.begin(), length.end(), end - length.size());
+
+        for (size_t word = 0; word < SHA256_STATE_LENGTH; ++word)
+            state[word * lanes + column] = initial.state[word];
+
+        ++active;
+    };
+
+    for (size_t column = 0; column < lanes; ++column)
+    {
+        lane[column].blocks = 0;
+        lane[column].pads = 0;
+
+        if (next < in.size())
+            start(column);
+    }
+
+    while (active > 0 && (next < in.size() || active * 2 > lanes))
+    {
+        for (size_t column = 0; column < lanes; ++column)
+        {
+            const auto& it = lane[column];
+            blocks[column] = it.blocks > 0 ? it.next :
+                (it.pads > 0 ? it.padding : idle);
+        }
+
+        transform(state, blocks);
+
+        for (size_t column = 0; column < lanes; ++column)
+        {
+            auto& it = lane[column];
+
+            if (it.blocks > 0)
+            {
+                --it.blocks;
+                it.next += SHA256_BLOCK_LENGTH;
+            }
+            else if (it.pads > 0)
+            {
+                --it.pads;
+                it.padding += SHA256_BLOCK_LENGTH;
+
+                if (it.pads == 0)
+                {
+                    sha256_digest(out[it.message], &state[column], lanes);
+                    --active;
+
+                    if (next < in.size())
+                        start(column);
+                }
+            }
+        }
+    }
+
+    const auto transformer = SHA256GetTransformer();
+
+    for (size_t column = 0; column < lanes; ++column)
+    {
+        const auto& it = lane[column];
+
+        if (it.blocks == 0 && it.pads == 0)
+            continue;
+
+        uint32_t single[SHA256_STATE_LENGTH];
+        for (size_t word = 0; word < SHA256_STATE_LENGTH; ++word)
+            single[word] = state[word * lanes + column];
+
+        transformer(single, it.next, it.blocks);
+        transformer(single, it.padding, it.pads);
+        sha256_digest(out[it.message], single, 1);
+    }
+}
+
+static void sha256_batch(hash_list& out, const std::vector<data_slice>& in)
+{
+    BITCOIN_ASSERT(out.size() == in.size());
+
+#ifdef SHA256_X86
+    switch (sha256_lanes())
+    {
+        case 8:
+            sha256_lanes(out, in, 8, SHA256TransformAVX2x8);
+            return;
+        case 4:
+            sha256_lanes(out, in, 4, SHA256TransformSSE41x4);
+            return;
+        default:
+            break;
+    }
+#endif
+
+    for (size_t index = 0; index < in.size(); ++index)
+        out[index] = sha256_hash(in[index]);
+}
+
+hash_list bitcoin_hash_batch(const std::vector<data_slice>& data)
+{
+    hash_list first(data.size());
+    sha256_batch(first, data);
+
+    hash_list out(data.size());
+    const std::vector<data_slice> digests(first.begin(), first.end());
+    sha256_batch(out, digests);
+    return out;
+}
+
+hash_list bitcoin_hash_pairs(const hash_list& hashes)
+{
+    static_assert(sizeof(hash_digest) == hash_size, "unexpected padding");
+    BITCOIN_ASSERT(hashes.size() % 2 == 0);
+
+    const auto count = hashes.size() / 2;
+    hash_list out(count);
+
+    if (count == 0)
+        return out;
+
+    // The hashes of a pair are contiguous, forming a 64 byte message.
+    const auto pairs = hashes.front().data();
+    BC_CONSTEXPR auto pair_size = 2 * hash_size;
+    size_t index = 0;
+
+#ifdef SHA256_X86
+    const auto lanes = sha256_lanes();
+
+    if (lanes == 8)
+        for (; index + 8 <= count; index += 8)
+            SHA256DoubleAVX2x8(out[index].data(), pairs + index * pair_size);
+
+    if (lanes >= 4)
+        for (; index + 4 <= count; index += 4)
+            SHA256DoubleSSE41x4(out[index].data(), pairs + index * pair_size);
+#endif
+
+    for (; index < count; ++index)
+    {
+        const auto pair = pairs + index * pair_size;
+        out[index] = bitcoin_hash({ pair, pair + pair_size });
+    }
+
+    return out;
+}
+
 hash_digest scrypt_hash(const data_slice& data)
 {
     return scrypt<hash_size>(data, data, 1024u, 1u, 1u);
@@ -104,6 +334,105 @@ hash_digest sha256_hash(const data_slice& first, const data_slice& second)
     return hash;
 }
 
+sha256_state sha256_midstate(const data_slice& blocks)
+{
+    BITCOIN_ASSERT(blocks.size() % SHA256_BLOCK_LENGTH == 0);
+
+    SHA256CTX context;
+    SHA256Init(&context);
+    SHA256Update(&context, blocks.data(), blocks.size());
+
+    sha256_state midstate;
+    std::copy_n(context.state, midstate.size(), midstate.begin());
+    return midstate;
+}
+
+sha256_state sha256_midstate(const sha256_state& midstate,
+    const data_slice& blocks)
+{
+    BITCOIN_ASSERT(blocks.size() % SHA256_BLOCK_LENGTH == 0);
+
+    // The bit count only positions partial blocks, so it may start at zero.
+    SHA256CTX context;
+    std::copy(midstate.begin(), midstate.end(), context.state);
+    context.count[0] = 0;
+    context.count[1] = 0;
+    SHA256Update(&context, blocks.data(), blocks.size());
+
+    sha256_state state;
+    std::copy_n(context.state, state.size(), state.begin());
+    return state;
+}
+
+hash_digest sha256_hash(const sha256_state& midstate, size_t blocks,
+    const data_slice& data)
+{
+    // The bit count of the prefix is split into high and low words.
+    const uint64_t bits = blocks * SHA256_BLOCK_LENGTH * 8u;
+
+    hash_digest hash;
+    SHA256CTX context;
+    std::copy(midstate.begin(), midstate.end(), context.state);
+    context.count[0] = static_cast<uint32_t>(bits >> 32);
+    context.count[1] = static_cast<uint32_t>(bits);
+    SHA256Update(&context, data.data(), data.size());
+    SHA256Final(&context, hash.data());
+    return hash;
+}
+
+static SHA256Transformer sha256_transformer(sha256_backend backend)
+{
+    switch (backend)
+    {
+#ifdef SHA256_X86
+        case sha256_backend::sse41:
+            return have_sse41() ? SHA256TransformSSE41 : nullptr;
+        case sha256_backend::avx2:
+            return have_avx2() ? SHA256TransformAVX2 : nullptr;
+        case sha256_backend::shani:
+            return have_shani() ? SHA256TransformSHANI : nullptr;
+#endif
+        case sha256_backend::portable:
+            return SHA256TransformPortable;
+        default:
+            return nullptr;
+    }
+}
+
+bool sha256_available(sha256_backend backend)
+{
+    return sha256_transformer(backend) != nullptr;
+}
+
+sha256_backend get_sha256_backend()
+{
+    const auto transformer = SHA256GetTransformer();
+
+    for (const auto backend: { sha256_backend::shani, sha256_backend::avx2,
+        sha256_backend::sse41 })
+        if (transformer == sha256_transformer(backend))
+            return backend;
+
+    return sha256_backend::portable;
+}
+
+bool set_sha256_backend(sha256_backend backend)
+{
+    const auto transformer = sha256_transformer(backend);
+
+    if (transformer == nullptr)
+        return false;
+
+    SHA256SetTransformer(transformer);
+    return true;
+}
+
+// Select the fastest available backend during static initialization.
+// Hashing that precedes this (in other static initializers) is portable.
+static const auto sha256_selected = set_sha256_backend(sha256_backend::shani) ||
+    set_sha256_backend(sha256_backend::avx2) ||
+    set_sha256_backend(sha256_backend::sse41);
+
 hash_digest hmac_sha256_hash(const data_slice& data, const data_slice& key)
 {
     hash_digest hash;
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/math/murmur3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// MurmurHash3 x86_32, by Austin Appleby (public domain).
+// ----------------------------------------------------------------------------
+
+#define ROTATE(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
+
+static const uint32_t c1 = 0xcc9e2d51;
+static const uint32_t c2 = 0x1b873593;
+
+static inline uint32_t mix_block(uint32_t block)
+{
+    block *= c1;
+    block = ROTATE(block, 15);
+    return block * c2;
+}
+
+uint32_t murmur3(const data_slice& data, uint32_t seed)
+{
+    auto hash = seed;
+    const auto size = data.size();
+    const auto whole = size - (size % sizeof(uint32_t));
+    auto it = data.begin();
+
+    for (const auto end = it + whole; it != end; it += sizeof(uint32_t))
+    {
+        hash ^= mix_block(from_little_endian_unsafe<uint32_t>(it));
+        hash = ROTATE(hash, 13);
+        hash = hash * 5 + 0xe6546b64;
+    }
+
+    // The tail carries up to three remaining bytes, little endian.
+    uint32_t tail = 0;
+
+    for (size_t byte = 0; it != data.end(); ++it, ++byte)
+        tail |= static_cast<uint32_t>(*it) << (8 * byte);
+
+    if (size % sizeof(uint32_t) != 0)
+        hash ^= mix_block(tail);
+
+    // Finalization mix, forces all bits of the hash to avalanche.
+    hash ^= static_cast<uint32_t>(size);
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+#undef ROTATE
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/math/point_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system/math/elliptic_curve.hpp>
+#include <bitcoin/system/math/siphash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/pseudo_random.hpp>
+#include <bitcoin/system/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// 2^12 entries of 130 bytes is about 520KiB.
+const size_t point_cache::default_capacity = 4096;
+const size_t point_cache::stripe_count = 16;
+
+// static
+point_cache& point_cache::global()
+{
+    static point_cache instance;
+    return instance;
+}
+
+point_cache::point_cache(size_t capacity)
+  : key_({ { pseudo_random::next(), pseudo_random::next() } }),
+    stripes_(stripe_count),
+    capacity_(0),
+    hits_(0),
+    misses_(0)
+{
+    resize(capacity);
+}
+
+// Only public key sizes are cached, smaller values cannot be indexed.
+bool point_cache::cacheable(const data_slice& point) const
+{
+    return capacity_ != 0 && (point.size() == ec_compressed_size ||
+        point.size() == ec_uncompressed_size);
+}
+
+// Slots are selected by a keyed hash, so points that collide in one cache
+// cannot be precomputed to collide in another.
+uint64_t point_cache::to_index(const data_slice& point) const
+{
+    return siphash(key_, point);
+}
+
+bool point_cache::find(parsed_point& out, const data_slice& point) const
+{
+    if (!cacheable(point))
+        return false;
+
+    const auto index = to_index(point);
+    const auto& row = stripes_[index % stripe_count];
+    auto found = false;
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        shared_lock lock(row.mutex);
+
+        if (!row.entries.empty())
+        {
+            const auto& item = row.entries[(index / stripe_count) %
+                row.entries.size()];
+
+            found = item.size == point.size() && std::equal(point.begin(),
+                point.end(), item.point.begin());
+
+            if (found)
+                out = item.parsed;
+        }
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    ++(found ? hits_ : misses_);
+    return found;
+}
+
+void point_cache::insert(const data_slice& point, const parsed_point& parsed)
+{
+    if (!cacheable(point))
+        return;
+
+    const auto index = to_index(point);
+    auto& row = stripes_[index % stripe_count];
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(row.mutex);
+
+    if (!row.entries.empty())
+    {
+        auto& item = row.entries[(index / stripe_count) % row.entries.size()];
+        item.size = static_cast<uint8_t>(point.size());
+        std::copy(point.begin(), point.end(), item.point.begin());
+        item.parsed = parsed;
+    }
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void point_cache::resize(size_t capacity)
+{
+    // Each stripe is at least one entry if the cache is enabled.
+    const auto entries = capacity == 0 ? 0 :
+        std::max(capacity / stripe_count, size_t(1));
+
+    for (auto& row: stripes_)
+    {
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        unique_lock lock(row.mutex);
+        row.entries.assign(entries, entry{});
+        row.entries.shrink_to_fit();
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    capacity_ = entries * stripe_count;
+}
+
+void point_cache::clear()
+{
+    for (auto& row: stripes_)
+    {
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        unique_lock lock(row.mutex);
+        std::fill(row.entries.begin(), row.entries.end(), entry{});
+        ///////////////////////////////////////////////////////////////////////
+    }
+}
+
+size_t point_cache::capacity() const
+{
+    return capacity_;
+}
+
+size_t point_cache::hits() const
+{
+    return hits_;
+}
+
+size_t point_cache::misses() const
+{
+    return misses_;
+}
+
+} // namespace system
+} // namespace libbitcoin
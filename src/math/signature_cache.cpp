@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/math/signature_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <bitcoin/system/math/elliptic_curve.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+#include <bitcoin/system/utility/pseudo_random.hpp>
+#include <bitcoin/system/utility/sha256_writer.hpp>
+#include <bitcoin/system/utility/thread.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// 2^16 entries of 32 bytes is 2MiB.
+const size_t signature_cache::default_capacity = 65536;
+const size_t signature_cache::stripe_count = 64;
+
+// static
+signature_cache& signature_cache::global()
+{
+    static signature_cache instance;
+    return instance;
+}
+
+static hash_digest random_salt()
+{
+    hash_digest salt;
+    pseudo_random::fill(salt);
+    return salt;
+}
+
+signature_cache::signature_cache(size_t capacity)
+  : salt_(random_salt()),
+    stripes_(stripe_count),
+    capacity_(0),
+    hits_(0),
+    misses_(0)
+{
+    resize(capacity);
+}
+
+// The salt prevents targeted collisions, as the key space is public.
+// The parts are hashed in place, without a concatenated copy.
+hash_digest signature_cache::to_key(const hash_digest& sighash,
+    const data_slice& public_key, const ec_signature& signature) const
+{
+    sha256_writer sink;
+    sink.write_hash(salt_);
+    sink.write_hash(sighash);
+    sink.write_bytes(signature.data(), signature.size());
+    sink.write_bytes(public_key);
+    return sink.sha256_digest();
+}
+
+bool signature_cache::contains(const hash_digest& sighash,
+    const data_slice& public_key, const ec_signature& signature) const
+{
+    if (capacity_ == 0)
+        return false;
+
+    const auto key = to_key(sighash, public_key, signature);
+    const auto& row = stripes_[from_little_endian_unsafe<uint32_t>(
+        key.begin()) % stripe_count];
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    shared_lock lock(row.mutex);
+
+    const auto found = !row.entries.empty() && row.entries[
+        from_little_endian_unsafe<uint64_t>(key.begin() + sizeof(uint32_t)) %
+            row.entries.size()] == key;
+    ///////////////////////////////////////////////////////////////////////////
+
+    ++(found ? hits_ : misses_);
+    return found;
+}
+
+void signature_cache::insert(const hash_digest& sighash,
+    const data_slice& public_key, const ec_signature& signature)
+{
+    if (capacity_ == 0)
+        return;
+
+    const auto key = to_key(sighash, public_key, signature);
+    auto& row = stripes_[from_little_endian_unsafe<uint32_t>(key.begin()) %
+        stripe_count];
+
+    // Critical Section
+    ///////////////////////////////////////////////////////////////////////////
+    unique_lock lock(row.mutex);
+
+    if (!row.entries.empty())
+        row.entries[from_little_endian_unsafe<uint64_t>(key.begin() +
+            sizeof(uint32_t)) % row.entries.size()] = key;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void signature_cache::resize(size_t capacity)
+{
+    // Each stripe is at least one entry if the cache is enabled.
+    const auto entries = capacity == 0 ? 0 :
+        std::max(capacity / stripe_count, size_t(1));
+
+    for (auto& row: stripes_)
+    {
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        unique_lock lock(row.mutex);
+        row.entries.assign(entries, null_hash);
+        row.entries.shrink_to_fit();
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    capacity_ = entries * stripe_count;
+}
+
+void signature_cache::clear()
+{
+    for (auto& row: stripes_)
+    {
+        // Critical Section
+        ///////////////////////////////////////////////////////////////////////
+        unique_lock lock(row.mutex);
+        std::fill(row.entries.begin(), row.entries.end(), null_hash);
+        ///////////////////////////////////////////////////////////////////////
+    }
+}
+
+size_t signature_cache::capacity() const
+{
+    return capacity_;
+}
+
+size_t signature_cache::hits() const
+{
+    return hits_;
+}
+
+size_t signature_cache::misses() const
+{
+    return misses_;
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/math/siphash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// SipHash-2-4, by Jean-Philippe Aumasson and Daniel J. Bernstein.
+// ----------------------------------------------------------------------------
+
+#define ROTATE(value, bits) (((value) << (bits)) | ((value) >> (64 - (bits))))
+
+#define SIPROUND(v0, v1, v2, v3) \
+    v0 += v1; v1 = ROTATE(v1, 13); v1 ^= v0; v0 = ROTATE(v0, 32); \
+    v2 += v3; v3 = ROTATE(v3, 16); v3 ^= v2; \
+    v0 += v3; v3 = ROTATE(v3, 21); v3 ^= v0; \
+    v2 += v1; v1 = ROTATE(v1, 17); v1 ^= v2; v2 = ROTATE(v2, 32)
+
+static const uint64_t initial0 = 0x736f6d6570736575;
+static const uint64_t initial1 = 0x646f72616e646f6d;
+static const uint64_t initial2 = 0x6c7967656e657261;
+static const uint64_t initial3 = 0x7465646279746573;
+
+// The number of messages hashed together in the batch.
+static const size_t lanes = 4;
+
+siphash_key to_siphash_key(const half_hash& key)
+{
+    return
+    {
+        {
+            from_little_endian_unsafe<uint64_t>(key.begin()),
+            from_little_endian_unsafe<uint64_t>(key.begin() + sizeof(uint64_t))
+        }
+    };
+}
+
+uint64_t siphash(const siphash_key& key, const data_slice& message)
+{
+    auto v0 = initial0 ^ key[0];
+    auto v1 = initial1 ^ key[1];
+    auto v2 = initial2 ^ key[0];
+    auto v3 = initial3 ^ key[1];
+
+    const auto size = message.size();
+    const auto whole = size - (size % sizeof(uint64_t));
+    auto it = message.begin();
+
+    for (const auto end = it + whole; it != end; it += sizeof(uint64_t))
+    {
+        const auto word = from_little_endian_unsafe<uint64_t>(it);
+        v3 ^= word;
+        SIPROUND(v0, v1, v2, v3);
+        SIPROUND(v0, v1, v2, v3);
+        v0 ^= word;
+    }
+
+    // The final word carries the remaining bytes and the low byte of size.
+    auto last = static_cast<uint64_t>(size) << 56;
+
+    for (size_t byte = 0; it != message.end(); ++it, ++byte)
+        last |= static_cast<uint64_t>(*it) << (8 * byte);
+
+    v3 ^= last;
+    SIPROUND(v0, v1, v2, v3);
+    SIPROUND(v0, v1, v2, v3);
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    SIPROUND(v0, v1, v2, v3);
+    SIPROUND(v0, v1, v2, v3);
+    SIPROUND(v0, v1, v2, v3);
+    SIPROUND(v0, v1, v2, v3);
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+uint64_t siphash(const siphash_key& key, const hash_digest& hash)
+{
+    return siphash(key, data_slice(hash));
+}
+
+// The state of each lane is held in its own array, so that each step of each
+// round is a loop over lanes with no dependency between iterations.
+std::vector<uint64_t> siphash(const siphash_key& key, const hash_list& hashes)
+{
+    static const size_t words = hash_size / sizeof(uint64_t);
+    static const uint64_t last = static_cast<uint64_t>(hash_size) << 56;
+
+    std::vector<uint64_t> out(hashes.size());
+    const auto full = hashes.size() - (hashes.size() % lanes);
+
+    for (size_t base = 0; base < full; base += lanes)
+    {
+        uint64_t v0[lanes], v1[lanes], v2[lanes], v3[lanes], word[lanes];
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            v0[lane] = initial0 ^ key[0];
+            v1[lane] = initial1 ^ key[1];
+            v2[lane] = initial2 ^ key[0];
+            v3[lane] = initial3 ^ key[1];
+        }
+
+        for (size_t index = 0; index < words; ++index)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                word[lane] = from_little_endian_unsafe<uint64_t>(
+                    hashes[base + lane].begin() + index * sizeof(uint64_t));
+                v3[lane] ^= word[lane];
+            }
+
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+                SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+                v0[lane] ^= word[lane];
+            }
+        }
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            v3[lane] ^= last;
+            SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+            SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+            v0[lane] ^= last;
+            v2[lane] ^= 0xff;
+            SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+            SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+            SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+            SIPROUND(v0[lane], v1[lane], v2[lane], v3[lane]);
+            out[base + lane] = v0[lane] ^ v1[lane] ^ v2[lane] ^ v3[lane];
+        }
+    }
+
+    for (auto index = full; index < hashes.size(); ++index)
+        out[index] = siphash(key, hashes[index]);
+
+    return out;
+}
+
+#undef SIPROUND
+#undef ROTATE
+
+} // namespace system
+} // namespace libbitcoin
@@ -21,6 +21,7 @@
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -101,8 +102,8 @@ void block_transactions::reset()
 bool block_transactions::from_data(uint32_t version,
     const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool block_transactions::from_data(uint32_t version,
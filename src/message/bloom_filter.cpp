@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/message/bloom_filter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/machine/operation_view.hpp>
+#include <bitcoin/system/math/murmur3.hpp>
+#include <bitcoin/system/message/filter_add.hpp>
+#include <bitcoin/system/message/filter_load.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace message {
+
+using namespace bc::system::chain;
+using namespace bc::system::machine;
+
+static const double ln2 = 0.693147180559945309417;
+static const double ln2_squared = ln2 * ln2;
+
+// The seed multiplier that separates the hash functions (BIP37).
+static const uint32_t seed_factor = 0xfba4c795;
+
+// An outpoint element is its wire serialization, hash then index.
+typedef byte_array<hash_size + sizeof(uint32_t)> point_element;
+
+static point_element to_element(const point& point)
+{
+    point_element out;
+    const auto index = to_little_endian(point.index());
+    std::copy(point.hash().begin(), point.hash().end(), out.begin());
+    std::copy(index.begin(), index.end(), out.begin() + hash_size);
+    return out;
+}
+
+bloom_filter::bloom_filter()
+  : filter_(), hash_functions_(0), tweak_(0), flags_(update::none)
+{
+}
+
+// Sizing is as the satoshi client, so that equal parameters produce filters
+// of equal size and hash function count (including the integer division).
+bloom_filter::bloom_filter(size_t elements, double false_positive_rate,
+    uint32_t tweak, uint8_t flags)
+  : tweak_(tweak), flags_(flags)
+{
+    static const auto max_bits = static_cast<double>(max_filter_load * 8u);
+    elements = std::max(elements, size_t(1));
+
+    const auto bits = -1.0 / ln2_squared * elements *
+        std::log(false_positive_rate);
+
+    filter_.resize(static_cast<size_t>(
+        std::max(std::min(bits, max_bits), 0.0)) / 8u);
+
+    const auto functions = filter_.size() * 8u / elements * ln2;
+    hash_functions_ = static_cast<uint32_t>(std::min(functions,
+        static_cast<double>(max_filter_functions)));
+}
+
+bloom_filter::bloom_filter(const filter_load& load)
+  : filter_(load.filter()), hash_functions_(load.hash_functions()),
+    tweak_(load.tweak()), flags_(load.flags())
+{
+}
+
+bloom_filter::bloom_filter(filter_load&& load)
+  : filter_(std::move(load.filter())), hash_functions_(load.hash_functions()),
+    tweak_(load.tweak()), flags_(load.flags())
+{
+}
+
+bool bloom_filter::is_valid() const
+{
+    return filter_.size() <= max_filter_load &&
+        hash_functions_ <= max_filter_functions;
+}
+
+const data_chunk& bloom_filter::filter() const
+{
+    return filter_;
+}
+
+uint32_t bloom_filter::hash_functions() const
+{
+    return hash_functions_;
+}
+
+uint32_t bloom_filter::tweak() const
+{
+    return tweak_;
+}
+
+uint8_t bloom_filter::flags() const
+{
+    return flags_;
+}
+
+filter_load bloom_filter::to_filter_load() const
+{
+    return { filter_, hash_functions_, tweak_, flags_ };
+}
+
+// Elements.
+// ----------------------------------------------------------------------------
+
+// private
+uint32_t bloom_filter::bit(uint32_t hash_number,
+    const data_slice& element) const
+{
+    const auto bits = static_cast<uint32_t>(filter_.size() * 8u);
+    return murmur3(element, hash_number * seed_factor + tweak_) % bits;
+}
+
+void bloom_filter::insert(const data_slice& element)
+{
+    if (filter_.empty())
+        return;
+
+    for (uint32_t hash = 0; hash < hash_functions_; ++hash)
+    {
+        const auto index = bit(hash, element);
+        filter_[index >> 3] |= (1u << (index & 7u));
+    }
+}
+
+void bloom_filter::insert(const point& point)
+{
+    insert(to_element(point));
+}
+
+bool bloom_filter::add(const filter_add& message)
+{
+    if (message.data().size() > max_filter_add)
+        return false;
+
+    insert(message.data());
+    return true;
+}
+
+bool bloom_filter::contains(const data_slice& element) const
+{
+    if (filter_.empty())
+        return true;
+
+    for (uint32_t hash = 0; hash < hash_functions_; ++hash)
+    {
+        const auto index = bit(hash, element);
+
+        if ((filter_[index >> 3] & (1u << (index & 7u))) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+bool bloom_filter::contains(const point& point) const
+{
+    return contains(to_element(point));
+}
+
+// Transactions.
+// ----------------------------------------------------------------------------
+
+// The outputs are matched (and the filter updated) before the inputs, so that
+// a transaction spending its own matched output matches.
+bool bloom_filter::match(const transaction& tx)
+{
+    const auto found = match_outputs(tx);
+    return found || match_inputs(tx);
+}
+
+std::vector<bool> bloom_filter::match(const block& block)
+{
+    std::vector<bool> out;
+    out.reserve(block.transactions().size());
+
+    for (const auto& tx: block.transactions())
+        out.push_back(match(tx));
+
+    return out;
+}
+
+// private
+// Each output is matched, as a match inserts the outpoint under update flags.
+bool bloom_filter::match_outputs(const transaction& tx)
+{
+    const auto hash = tx.hash();
+    auto found = contains(hash);
+    const auto& outputs = tx.outputs();
+
+    for (uint32_t index = 0; index < outputs.size(); ++index)
+    {
+        const auto& script = outputs[index].script();
+        const auto ops = operation_view::decode(script.encoded());
+        const auto matched = std::any_of(ops.begin(), ops.end(),
+            [this](const operation_view& op)
+            {
+                return !op.data().empty() && contains(op.data());
+            });
+
+        if (!matched)
+            continue;
+
+        found = true;
+        const auto behavior = flags_ & update::mask;
+
+        if (behavior == update::all)
+        {
+            insert(point{ hash, index });
+        }
+        else if (behavior == update::p2pubkey_only)
+        {
+            const auto& operations = script.operations();
+
+            if (script::is_pay_public_key_pattern(operations) ||
+                script::is_pay_multisig_pattern(operations))
+                insert(point{ hash, index });
+        }
+    }
+
+    return found;
+}
+
+// private
+bool bloom_filter::match_inputs(const transaction& tx) const
+{
+    for (const auto& input: tx.inputs())
+    {
+        if (contains(input.previous_output()))
+            return true;
+
+        const auto ops = operation_view::decode(input.script().encoded());
+
+        for (const auto& op: ops)
+            if (!op.data().empty() && contains(op.data()))
+                return true;
+    }
+
+    return false;
+}
+
+} // namespace message
+} // namespace system
+} // namespace libbitcoin
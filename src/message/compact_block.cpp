@@ -18,10 +18,16 @@
  */
 #include <bitcoin/system/message/compact_block.hpp>
 
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/math/limits.hpp>
+#include <bitcoin/system/math/siphash.hpp>
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -92,6 +98,27 @@ compact_block::compact_block(compact_block&& other)
 {
 }
 
+compact_block::compact_block(const chain::block& block, uint64_t nonce,
+    bool witness)
+  : header_(block.header()), nonce_(nonce), short_ids_(), transactions_()
+{
+    const auto& txs = block.transactions();
+
+    if (txs.empty())
+        return;
+
+    // The coinbase cannot be in a peer's pool, so it is always prefilled.
+    transactions_.emplace_back(0, txs.front());
+
+    hash_list hashes;
+    hashes.reserve(txs.size() - 1);
+
+    for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+        hashes.push_back(tx->hash(witness));
+
+    short_ids_ = to_short_ids(short_id_key(), hashes);
+}
+
 bool compact_block::is_valid() const
 {
     return header_.is_valid() && !short_ids_.empty() && !transactions_.empty();
@@ -107,10 +134,40 @@ void compact_block::reset()
     transactions_.shrink_to_fit();
 }
 
+siphash_key compact_block::short_id_key() const
+{
+    const auto hash = sha256_hash(build_chunk(
+    {
+        header_.to_data(),
+        to_little_endian(nonce_)
+    }));
+
+    return to_siphash_key(slice<0, half_hash_size>(hash));
+}
+
+// static
+compact_block::short_id_list compact_block::to_short_ids(
+    const siphash_key& key, const hash_list& hashes)
+{
+    const auto values = siphash(key, hashes);
+    short_id_list out;
+    out.reserve(values.size());
+
+    // A short id is the low six bytes of the SipHash, little-endian.
+    for (const auto value: values)
+    {
+        const auto bytes = to_little_endian(value);
+        out.emplace_back();
+        std::copy_n(bytes.begin(), out.back().size(), out.back().begin());
+    }
+
+    return out;
+}
+
 bool compact_block::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool compact_block::from_data(uint32_t version, std::istream& stream)
@@ -19,6 +19,7 @@
 #include <bitcoin/system/message/fee_filter.hpp>
 
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -90,8 +91,8 @@ fee_filter::fee_filter(fee_filter&& other)
 
 bool fee_filter::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool fee_filter::from_data(uint32_t version, std::istream& stream)
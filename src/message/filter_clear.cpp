@@ -19,6 +19,7 @@
 #include <bitcoin/system/message/filter_clear.hpp>
 
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -93,8 +94,8 @@ void filter_clear::reset()
 
 bool filter_clear::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool filter_clear::from_data(uint32_t version, std::istream& stream)
@@ -22,6 +22,7 @@
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/version.hpp>
 #include <bitcoin/system/utility/assert.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -109,8 +110,8 @@ void filter_load::reset()
 
 bool filter_load::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool filter_load::from_data(uint32_t version, std::istream& stream)
@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/message/frame_writer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/limits.hpp>
+#include <bitcoin/system/utility/data.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+#include <bitcoin/system/utility/serializer.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace message {
+
+// This is the wire form of message::heading, written without an allocation.
+template <typename Iterator>
+static void write_heading(Iterator out, uint32_t magic,
+    const std::string& command, size_t payload_size, const hash_digest& hash)
+{
+    auto sink = make_unsafe_serializer(out);
+    sink.write_4_bytes_little_endian(magic);
+    sink.write_string(command, command_size);
+    sink.write_4_bytes_little_endian(safe_unsigned<uint32_t>(payload_size));
+    sink.write_4_bytes_little_endian(
+        from_little_endian_unsafe<uint32_t>(hash.begin()));
+}
+
+heading_bytes frame_heading(uint32_t magic, const std::string& command,
+    const data_slice& payload)
+{
+    heading_bytes out;
+    write_heading(out.begin(), magic, command, payload.size(),
+        bitcoin_hash(payload));
+    return out;
+}
+
+frame_writer::frame_writer(data_chunk& buffer, size_t payload_size)
+  : buffer_(buffer), position_(std::tuple_size<heading_bytes>::value),
+    valid_(true)
+{
+    buffer_.resize(position_ + payload_size);
+}
+
+bool frame_writer::finish(uint32_t magic, const std::string& command)
+{
+    if (!valid_ || position_ != buffer_.size())
+        return false;
+
+    const auto payload_size = buffer_.size() -
+        std::tuple_size<heading_bytes>::value;
+
+    write_heading(buffer_.begin(), magic, command, payload_size,
+        bitcoin_digest());
+    return true;
+}
+
+frame_writer::operator bool() const
+{
+    return valid_;
+}
+
+bool frame_writer::operator!() const
+{
+    return !valid_;
+}
+
+// All writes reduce to this, so each payload byte is copied once into the
+// buffer and hashed once from there.
+void frame_writer::write_bytes(const uint8_t* data, size_t size)
+{
+    if (!valid_ || size > buffer_.size() - position_)
+    {
+        valid_ = false;
+        return;
+    }
+
+    const auto start = buffer_.data() + position_;
+    std::copy_n(data, size, start);
+    sha256_writer::write_bytes(start, size);
+    position_ += size;
+}
+
+} // namespace message
+} // namespace system
+} // namespace libbitcoin
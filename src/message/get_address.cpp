@@ -19,6 +19,7 @@
 #include <bitcoin/system/message/get_address.hpp>
 
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -71,8 +72,8 @@ void get_address::reset()
 
 bool get_address::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool get_address::from_data(uint32_t version, std::istream& stream)
@@ -19,19 +19,27 @@
 #include <bitcoin/system/message/headers.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <istream>
+#include <memory>
 #include <utility>
+#include <vector>
+#include <bitcoin/system/chain/chain_state.hpp>
+#include <bitcoin/system/error.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/message/inventory.hpp>
 #include <bitcoin/system/message/inventory_vector.hpp>
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
 #include <bitcoin/system/utility/ostream_writer.hpp>
+#include <bitcoin/system/utility/parallel_for.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -106,8 +114,8 @@ void headers::reset()
 
 bool headers::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool headers::from_data(uint32_t version, std::istream& stream)
@@ -211,6 +219,99 @@ void headers::to_inventory(inventory_vector::list& out,
     std::for_each(elements_.begin(), elements_.end(), map);
 }
 
+// Validation.
+//-----------------------------------------------------------------------------
+
+void headers::cache_hashes() const
+{
+    const auto size = chain::header::satoshi_fixed_size();
+
+    // Serialize the block hash preimages contiguously for lane hashing.
+    data_chunk data;
+    data.reserve(elements_.size() * size);
+    data_sink ostream(data);
+    ostream_writer sink(ostream);
+
+    for (const auto& element: elements_)
+        static_cast<const chain::header&>(element).to_data(sink, true);
+
+    ostream.flush();
+    BITCOIN_ASSERT(data.size() == elements_.size() * size);
+
+    std::vector<data_slice> preimages;
+    preimages.reserve(elements_.size());
+
+    for (size_t offset = 0; offset < data.size(); offset += size)
+        preimages.emplace_back(&data[offset], &data[offset] + size);
+
+    const auto hashes = bitcoin_hash_batch(preimages);
+
+    for (size_t index = 0; index < elements_.size(); ++index)
+        static_cast<const chain::header&>(elements_[index]).cache_hash(
+            hashes[index]);
+}
+
+code headers::check(uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, bool scrypt) const
+{
+    cache_hashes();
+
+    for (const auto& element: elements_)
+    {
+        const auto ec = element.check(timestamp_limit_seconds,
+            proof_of_work_limit, scrypt);
+
+        if (ec)
+            return ec;
+    }
+
+    return is_sequential() ? error::success : error::invalid_previous_block;
+}
+
+code headers::check(uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, threadpool& pool, bool scrypt) const
+{
+    // Hashes are cached before checking, so header reads do not contend.
+    cache_hashes();
+
+    const auto ec = parallel_for(pool, elements_.size(), [&](size_t index)
+    {
+        return elements_[index].check(timestamp_limit_seconds,
+            proof_of_work_limit, scrypt);
+    });
+
+    if (ec)
+        return ec;
+
+    return is_sequential() ? error::success : error::invalid_previous_block;
+}
+
+code headers::accept(const chain::chain_state& parent,
+    const system::settings& settings) const
+{
+    // Each state is retained by its header, so the chain of parents persists.
+    auto top = &parent;
+
+    for (const auto& element: elements_)
+    {
+        if (element.previous_block_hash() != top->hash())
+            return error::invalid_previous_block;
+
+        const auto state = std::make_shared<chain::chain_state>(*top, element,
+            settings);
+
+        element.metadata.state = state;
+        const auto ec = element.accept(*state);
+
+        if (ec)
+            return ec;
+
+        top = state.get();
+    }
+
+    return error::success;
+}
+
 size_t headers::serialized_size(uint32_t version) const
 {
     return variable_uint_size(elements_.size()) +
@@ -18,9 +18,18 @@
  */
 #include <bitcoin/system/message/heading.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
 #include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/utility/assert.hpp>
+#include <bitcoin/system/utility/endian.hpp>
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -30,6 +39,87 @@ namespace libbitcoin {
 namespace system {
 namespace message {
 
+// Commands are keyed by their wire form as little-endian 64 and 32 bit words,
+// and the key is perfectly hashed to a slot. The multiplier was searched for
+// a collision-free mapping of the message commands into the table.
+static constexpr size_t command_slots = 64;
+static constexpr size_t command_slot_bits = 6;
+static constexpr uint64_t command_multiplier = 0xa8c24d4244ef7feb;
+
+struct command_entry
+{
+    uint64_t low;
+    uint32_t high;
+    message_type type;
+};
+
+typedef std::array<command_entry, command_slots> command_table;
+
+static size_t command_slot(uint64_t low, uint32_t high)
+{
+    const auto key = low ^ (static_cast<uint64_t>(high) << 29);
+    return static_cast<size_t>((key * command_multiplier) >>
+        (64 - command_slot_bits));
+}
+
+static command_table make_command_table()
+{
+    const std::pair<const std::string&, message_type> commands[] =
+    {
+        { address::command, message_type::address },
+        { alert::command, message_type::alert },
+        { block::command, message_type::block },
+        { block_transactions::command, message_type::block_transactions },
+        { compact_block::command, message_type::compact_block },
+        { fee_filter::command, message_type::fee_filter },
+        { filter_add::command, message_type::filter_add },
+        { filter_clear::command, message_type::filter_clear },
+        { filter_load::command, message_type::filter_load },
+        { get_address::command, message_type::get_address },
+        { get_block_transactions::command,
+            message_type::get_block_transactions },
+        { get_blocks::command, message_type::get_blocks },
+        { get_data::command, message_type::get_data },
+        { get_headers::command, message_type::get_headers },
+        { headers::command, message_type::headers },
+        { inventory::command, message_type::inventory },
+        { memory_pool::command, message_type::memory_pool },
+        { merkle_block::command, message_type::merkle_block },
+        { not_found::command, message_type::not_found },
+        { ping::command, message_type::ping },
+        { pong::command, message_type::pong },
+        { reject::command, message_type::reject },
+        { send_compact::command, message_type::send_compact },
+        { send_headers::command, message_type::send_headers },
+        { transaction::command, message_type::transaction },
+        { verack::command, message_type::verack },
+        { version::command, message_type::version }
+    };
+
+    // Empty slots hold the empty command, which is never dispatched.
+    command_table table;
+    table.fill({ 0, 0, message_type::unknown });
+
+    for (const auto& command: commands)
+    {
+        byte_array<command_size> bytes{};
+        const auto& name = command.first;
+        std::copy_n(name.begin(), std::min(name.size(), bytes.size()),
+            bytes.begin());
+
+        const auto low = from_little_endian_unsafe<uint64_t>(bytes.begin());
+        const auto high = from_little_endian_unsafe<uint32_t>(bytes.begin() +
+            sizeof(uint64_t));
+
+        auto& entry = table[command_slot(low, high)];
+        BITCOIN_ASSERT_MSG(entry.type == message_type::unknown,
+            "message command hash collision");
+        entry = { low, high, command.second };
+    }
+
+    return table;
+}
+
 size_t heading::maximum_size()
 {
     // This assumes that the heading doesn't shrink in size.
@@ -84,32 +174,32 @@ heading heading::factory(reader& source)
 }
 
 heading::heading()
-  : magic_(0), command_(), payload_size_(0), checksum_(0)
+  : magic_(0), command_{}, payload_size_(0), checksum_(0)
 {
 }
 
 heading::heading(uint32_t magic, const std::string& command,
     uint32_t payload_size, uint32_t checksum)
-  : magic_(magic), command_(command), payload_size_(payload_size),
-    checksum_(checksum)
+  : magic_(magic), command_(to_command(command)),
+    payload_size_(payload_size), checksum_(checksum)
 {
 }
 
 heading::heading(uint32_t magic, std::string&& command, uint32_t payload_size,
     uint32_t checksum)
-  : magic_(magic), command_(std::move(command)), payload_size_(payload_size),
-    checksum_(checksum)
+  : magic_(magic), command_(to_command(command)),
+    payload_size_(payload_size), checksum_(checksum)
 {
 }
 
 heading::heading(const heading& other)
-  : heading(other.magic_, other.command_, other.payload_size_, other.checksum_)
+  : magic_(other.magic_), command_(other.command_),
+    payload_size_(other.payload_size_), checksum_(other.checksum_)
 {
 }
 
 heading::heading(heading&& other)
-  : heading(other.magic_, std::move(other.command_), other.payload_size_,
-      other.checksum_)
+  : heading(other)
 {
 }
 
@@ -118,22 +208,21 @@ bool heading::is_valid() const
     return (magic_ != 0)
         || (payload_size_ != 0)
         || (checksum_ != 0)
-        || !command_.empty();
+        || (command_.front() != 0);
 }
 
 void heading::reset()
 {
     magic_ = 0;
-    command_.clear();
-    command_.shrink_to_fit();
+    command_.fill(0);
     payload_size_ = 0;
     checksum_ = 0;
 }
 
 bool heading::from_data(const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(istream);
+    byte_reader source(data);
+    return from_data(source);
 }
 
 bool heading::from_data(std::istream& stream)
@@ -146,7 +235,14 @@ bool heading::from_data(reader& source)
 {
     reset();
     magic_ = source.read_4_bytes_little_endian();
-    command_ = source.read_string(command_size);
+
+    // The command is read without allocation, as words of its fixed size.
+    const auto low = to_little_endian(source.read_8_bytes_little_endian());
+    const auto high = to_little_endian(source.read_4_bytes_little_endian());
+    std::copy(low.begin(), low.end(), command_.begin());
+    std::copy(high.begin(), high.end(), command_.begin() + low.size());
+    terminate(command_);
+
     payload_size_ = source.read_4_bytes_little_endian();
     checksum_ = source.read_4_bytes_little_endian();
 
@@ -177,70 +273,21 @@ void heading::to_data(std::ostream& stream) const
 void heading::to_data(writer& sink) const
 {
     sink.write_4_bytes_little_endian(magic_);
-    sink.write_string(command_, command_size);
+    sink.write_bytes(command_);
     sink.write_4_bytes_little_endian(payload_size_);
     sink.write_4_bytes_little_endian(checksum_);
 }
 
 message_type heading::type() const
 {
-    // TODO: convert to static map.
-    if (command_ == address::command)
-        return message_type::address;
-    if (command_ == alert::command)
-        return message_type::alert;
-    if (command_ == block_transactions::command)
-        return message_type::block_transactions;
-    if (command_ == block::command)
-        return message_type::block;
-    if (command_ == compact_block::command)
-        return message_type::compact_block;
-    if (command_ == fee_filter::command)
-        return message_type::fee_filter;
-    if (command_ == filter_add::command)
-        return message_type::filter_add;
-    if (command_ == filter_clear::command)
-        return message_type::filter_clear;
-    if (command_ == filter_load::command)
-        return message_type::filter_load;
-    if (command_ == get_address::command)
-        return message_type::get_address;
-    if (command_ == get_block_transactions::command)
-        return message_type::get_block_transactions;
-    if (command_ == get_blocks::command)
-        return message_type::get_blocks;
-    if (command_ == get_data::command)
-        return message_type::get_data;
-    if (command_ == get_headers::command)
-        return message_type::get_headers;
-    if (command_ == headers::command)
-        return message_type::headers;
-    if (command_ == inventory::command)
-        return message_type::inventory;
-    if (command_ == memory_pool::command)
-        return message_type::memory_pool;
-    if (command_ == merkle_block::command)
-        return message_type::merkle_block;
-    if (command_ == not_found::command)
-        return message_type::not_found;
-    if (command_ == ping::command)
-        return message_type::ping;
-    if (command_ == pong::command)
-        return message_type::pong;
-    if (command_ == reject::command)
-        return message_type::reject;
-    if (command_ == send_compact::command)
-        return message_type::send_compact;
-    if (command_ == send_headers::command)
-        return message_type::send_headers;
-    if (command_ == transaction::command)
-        return message_type::transaction;
-    if (command_ == verack::command)
-        return message_type::verack;
-    if (command_ == version::command)
-        return message_type::version;
-
-    return message_type::unknown;
+    static const auto table = make_command_table();
+    const auto low = from_little_endian_unsafe<uint64_t>(command_.begin());
+    const auto high = from_little_endian_unsafe<uint32_t>(command_.begin() +
+        sizeof(uint64_t));
+
+    const auto& entry = table[command_slot(low, high)];
+    return entry.low == low && entry.high == high ? entry.type :
+        message_type::unknown;
 }
 
 uint32_t heading::magic() const
@@ -253,24 +300,20 @@ void heading::set_magic(uint32_t value)
     magic_ = value;
 }
 
-std::string& heading::command()
-{
-    return command_;
-}
-
-const std::string& heading::command() const
+std::string heading::command() const
 {
-    return command_;
+    const auto end = std::find(command_.begin(), command_.end(), 0);
+    return { command_.begin(), end };
 }
 
 void heading::set_command(const std::string& value)
 {
-    command_ = value;
+    command_ = to_command(value);
 }
 
 void heading::set_command(std::string&& value)
 {
-    command_ = std::move(value);
+    command_ = to_command(value);
 }
 
 uint32_t heading::payload_size() const
@@ -296,7 +339,7 @@ void heading::set_checksum(uint32_t value)
 heading& heading::operator=(heading&& other)
 {
     magic_ = other.magic_;
-    command_ = std::move(other.command_);
+    command_ = other.command_;
     payload_size_ = other.payload_size_;
     checksum_ = other.checksum_;
     return *this;
@@ -315,6 +358,26 @@ bool heading::operator!=(const heading& other) const
     return !(*this == other);
 }
 
+// private
+// ----------------------------------------------------------------------------
+
+// static
+heading::command_bytes heading::to_command(const std::string& value)
+{
+    command_bytes out{};
+    std::copy_n(value.begin(), std::min(value.size(), out.size()),
+        out.begin());
+    terminate(out);
+    return out;
+}
+
+// Bytes following a null are ignored, as if the command were a string.
+// static
+void heading::terminate(command_bytes& command)
+{
+    std::fill(std::find(command.begin(), command.end(), 0), command.end(), 0);
+}
+
 } // namespace message
 } // namespace system
 } // namespace libbitcoin
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <string>
 #include <bitcoin/system/message/inventory.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -133,8 +134,8 @@ void inventory_vector::to_witness()
 bool inventory_vector::from_data(uint32_t version,
     const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool inventory_vector::from_data(uint32_t version,
@@ -19,6 +19,7 @@
 #include <bitcoin/system/message/memory_pool.hpp>
 
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -92,8 +93,8 @@ void memory_pool::reset()
 
 bool memory_pool::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool memory_pool::from_data(uint32_t version, std::istream& stream)
@@ -18,12 +18,18 @@
  */
 #include <bitcoin/system/message/merkle_block.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
 #include <bitcoin/system/chain/block.hpp>
 #include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/math/hash.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/message/messages.hpp>
 #include <bitcoin/system/message/version.hpp>
 #include <bitcoin/system/utility/assert.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -37,6 +43,171 @@ const std::string merkle_block::command = "merkleblock";
 const uint32_t merkle_block::version_minimum = version::level::bip37;
 const uint32_t merkle_block::version_maximum = version::level::maximum;
 
+// Partial merkle tree (BIP37).
+// ----------------------------------------------------------------------------
+// Nodes are addressed by height above the transactions and position within
+// the level. Flag bits and hashes are in depth first order, a set bit marks a
+// node that is a matched transaction or an ancestor of one.
+
+// The smallest (60 byte) transaction bounds the transaction count of a block.
+static const size_t max_block_transactions = max_block_size / 60u;
+
+static size_t tree_width(size_t total, size_t height)
+{
+    return (total + (size_t(1) << height) - 1u) >> height;
+}
+
+static size_t tree_height(size_t total)
+{
+    size_t height = 0;
+
+    while (tree_width(total, height) > 1u)
+        ++height;
+
+    return height;
+}
+
+static hash_digest hash_pair(const hash_digest& left,
+    const hash_digest& right)
+{
+    byte_array<2u * hash_size> pair;
+    std::copy(left.begin(), left.end(), pair.begin());
+    std::copy(right.begin(), right.end(), pair.begin() + hash_size);
+    return bitcoin_hash(pair);
+}
+
+static bool get_bit(const data_chunk& flags, size_t bit)
+{
+    return ((flags[bit / 8u] >> (bit % 8u)) & 1u) != 0;
+}
+
+static void set_bit(data_chunk& flags, size_t bit)
+{
+    flags[bit / 8u] |= static_cast<uint8_t>(1u << (bit % 8u));
+}
+
+// The subtree root, reduced a level at a time in hash lanes. The last node of
+// a level pairs with itself, as in the block merkle root.
+static hash_digest subtree_hash(const hash_list& hashes, size_t height,
+    size_t position)
+{
+    const auto begin = position << height;
+    const auto end = std::min(begin + (size_t(1) << height), hashes.size());
+
+    if (height == 0)
+        return hashes[begin];
+
+    hash_list level(hashes.begin() + begin, hashes.begin() + end);
+
+    for (size_t step = 0; step < height; ++step)
+    {
+        if (level.size() % 2u != 0)
+            level.push_back(level.back());
+
+        level = bitcoin_hash_pairs(level);
+    }
+
+    return level.front();
+}
+
+struct tree_builder
+{
+    const hash_list& hashes;
+    std::vector<size_t> matched;
+    size_t bits;
+    hash_list& out_hashes;
+    data_chunk& out_flags;
+
+    // Matched transactions are counted by prefix so that each node queries
+    // its range in constant time.
+    bool is_parent_of_match(size_t height, size_t position) const
+    {
+        const auto begin = position << height;
+        const auto end = std::min(begin + (size_t(1) << height),
+            hashes.size());
+
+        return matched[end] != matched[begin];
+    }
+
+    void build(size_t height, size_t position)
+    {
+        const auto parent = is_parent_of_match(height, position);
+
+        if (bits / 8u == out_flags.size())
+            out_flags.push_back(0);
+
+        if (parent)
+            set_bit(out_flags, bits);
+
+        ++bits;
+
+        if (height == 0 || !parent)
+        {
+            out_hashes.push_back(subtree_hash(hashes, height, position));
+            return;
+        }
+
+        build(height - 1u, position * 2u);
+
+        if (position * 2u + 1u < tree_width(hashes.size(), height - 1u))
+            build(height - 1u, position * 2u + 1u);
+    }
+};
+
+struct tree_extractor
+{
+    const hash_list& hashes;
+    const data_chunk& flags;
+    size_t total;
+    size_t bits;
+    size_t hashes_used;
+    hash_list& out_hashes;
+    std::vector<size_t>& out_indexes;
+
+    bool extract(size_t height, size_t position, hash_digest& out_hash)
+    {
+        if (bits >= flags.size() * 8u)
+            return false;
+
+        const auto parent = get_bit(flags, bits++);
+
+        if (height == 0 || !parent)
+        {
+            if (hashes_used >= hashes.size())
+                return false;
+
+            out_hash = hashes[hashes_used++];
+
+            if (height == 0 && parent)
+            {
+                out_hashes.push_back(out_hash);
+                out_indexes.push_back(position);
+            }
+
+            return true;
+        }
+
+        hash_digest left;
+        if (!extract(height - 1u, position * 2u, left))
+            return false;
+
+        auto right = left;
+
+        if (position * 2u + 1u < tree_width(total, height - 1u))
+        {
+            if (!extract(height - 1u, position * 2u + 1u, right))
+                return false;
+
+            // A duplicated subtree would allow a second tree of the same root.
+            if (right == left)
+                return false;
+        }
+
+        out_hash = hash_pair(left, right);
+        return true;
+    }
+};
+
 merkle_block merkle_block::factory(uint32_t version, const data_chunk& data)
 {
     merkle_block instance;
@@ -87,6 +258,27 @@ merkle_block::merkle_block(const chain::block& block)
 {
 }
 
+merkle_block::merkle_block(const chain::block& block,
+    const std::vector<bool>& matches)
+  : header_(block.header()),
+    total_transactions_(block.transactions().size()), hashes_(), flags_()
+{
+    const auto hashes = block.to_hashes();
+    BITCOIN_ASSERT(matches.size() == hashes.size());
+
+    if (hashes.empty())
+        return;
+
+    tree_builder builder{ hashes, { 0 }, 0, hashes_, flags_ };
+    builder.matched.reserve(hashes.size() + 1u);
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        builder.matched.push_back(builder.matched.back() +
+            (index < matches.size() && matches[index] ? 1u : 0u));
+
+    builder.build(tree_height(hashes.size()), 0);
+}
+
 merkle_block::merkle_block(const merkle_block& other)
   : merkle_block(other.header_, other.total_transactions_, other.hashes_,
       other.flags_)
@@ -114,10 +306,41 @@ void merkle_block::reset()
     flags_.shrink_to_fit();
 }
 
+bool merkle_block::extract_matches(hash_list& out_hashes,
+    std::vector<size_t>& out_indexes) const
+{
+    out_hashes.clear();
+    out_indexes.clear();
+
+    if (total_transactions_ == 0 ||
+        total_transactions_ > max_block_transactions ||
+        hashes_.size() > total_transactions_ ||
+        flags_.size() * 8u < hashes_.size())
+        return false;
+
+    hash_digest root;
+    tree_extractor extractor{ hashes_, flags_, total_transactions_, 0, 0,
+        out_hashes, out_indexes };
+
+    const auto valid =
+        extractor.extract(tree_height(total_transactions_), 0, root) &&
+        (extractor.bits + 7u) / 8u == flags_.size() &&
+        extractor.hashes_used == hashes_.size() &&
+        root == header_.merkle_root();
+
+    if (!valid)
+    {
+        out_hashes.clear();
+        out_indexes.clear();
+    }
+
+    return valid;
+}
+
 bool merkle_block::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool merkle_block::from_data(uint32_t version, std::istream& stream)
@@ -269,6 +492,7 @@ void merkle_block::set_flags(data_chunk&& value)
 merkle_block& merkle_block::operator=(merkle_block&& other)
 {
     header_ = std::move(other.header_);
+    total_transactions_ = other.total_transactions_;
     hashes_ = std::move(other.hashes_);
     flags_ = std::move(other.flags_);
     return *this;
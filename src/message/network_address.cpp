@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -100,8 +101,8 @@ void network_address::reset()
 bool network_address::from_data(uint32_t version,
     const data_chunk& data, bool with_timestamp)
 {
-    data_source istream(data);
-    return from_data(version, istream, with_timestamp);
+    byte_reader source(data);
+    return from_data(version, source, with_timestamp);
 }
 
 bool network_address::from_data(uint32_t version,
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/message/partial_block.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/math/hash.hpp>
+#include <bitcoin/system/math/siphash.hpp>
+#include <bitcoin/system/message/block_transactions.hpp>
+#include <bitcoin/system/message/compact_block.hpp>
+#include <bitcoin/system/message/get_block_transactions.hpp>
+#include <bitcoin/system/utility/endian.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace message {
+
+// A short id is the low six bytes of a SipHash.
+static const uint64_t short_id_mask = 0x0000ffffffffffff;
+
+partial_block::partial_block(const compact_block& block, bool witness)
+  : header_(block.header()),
+    key_(block.short_id_key()),
+    witness_(witness),
+    valid_(false),
+    missing_(0)
+{
+    const auto& prefilled = block.transactions();
+    const auto& short_ids = block.short_ids();
+    const auto count = prefilled.size() + short_ids.size();
+
+    if (count == 0)
+        return;
+
+    transactions_.resize(count);
+    states_.resize(count, state::missing);
+    uint64_t next = 0;
+
+    // Each prefilled index is the offset from the slot after the previous.
+    for (const auto& element: prefilled)
+    {
+        if (element.index() >= count - next)
+            return;
+
+        const auto index = next + element.index();
+        transactions_[index] = element.transaction();
+        states_[index] = state::filled;
+        next = index + 1;
+    }
+
+    size_t slot = 0;
+    slots_.reserve(short_ids.size());
+
+    // Short ids fill the remaining slots in order.
+    for (const auto& id: short_ids)
+    {
+        while (states_[slot] == state::filled)
+            ++slot;
+
+        const auto value = from_little_endian<uint64_t>(id.begin(), id.end());
+
+        if (!slots_.emplace(value, slot++).second)
+            return;
+    }
+
+    missing_ = short_ids.size();
+    valid_ = true;
+}
+
+bool partial_block::is_valid() const
+{
+    return valid_;
+}
+
+bool partial_block::is_complete() const
+{
+    return valid_ && missing_ == 0;
+}
+
+void partial_block::fill(const chain::transaction::list& candidates)
+{
+    if (!valid_ || missing_ == 0)
+        return;
+
+    hash_list hashes;
+    hashes.reserve(candidates.size());
+
+    for (const auto& tx: candidates)
+        hashes.push_back(tx.hash(witness_));
+
+    const auto values = siphash(key_, hashes);
+
+    for (size_t candidate = 0; candidate < candidates.size(); ++candidate)
+    {
+        const auto it = slots_.find(values[candidate] & short_id_mask);
+
+        if (it == slots_.end())
+            continue;
+
+        const auto slot = it->second;
+
+        switch (states_[slot])
+        {
+            case state::missing:
+            {
+                transactions_[slot] = candidates[candidate];
+                states_[slot] = state::filled;
+                --missing_;
+                break;
+            }
+            case state::filled:
+            {
+                // Distinct candidates share the short id, so neither is used.
+                if (transactions_[slot].hash(witness_) != hashes[candidate])
+                {
+                    transactions_[slot] = chain::transaction{};
+                    states_[slot] = state::ambiguous;
+                    ++missing_;
+                }
+
+                break;
+            }
+            case state::ambiguous:
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+bool partial_block::fill(const block_transactions& response)
+{
+    const auto& transactions = response.transactions();
+
+    if (!valid_ || transactions.size() != missing_ ||
+        response.block_hash() != header_.hash())
+        return false;
+
+    auto tx = transactions.begin();
+
+    for (size_t slot = 0; slot < states_.size(); ++slot)
+    {
+        if (states_[slot] != state::filled)
+        {
+            transactions_[slot] = *tx++;
+            states_[slot] = state::filled;
+        }
+    }
+
+    missing_ = 0;
+    return true;
+}
+
+get_block_transactions partial_block::missing() const
+{
+    std::vector<uint64_t> indexes;
+    indexes.reserve(missing_);
+    uint64_t next = 0;
+
+    for (size_t slot = 0; slot < states_.size(); ++slot)
+    {
+        if (states_[slot] != state::filled)
+        {
+            indexes.push_back(slot - next);
+            next = slot + 1;
+        }
+    }
+
+    return { header_.hash(), std::move(indexes) };
+}
+
+bool partial_block::to_block(chain::block& out) const
+{
+    if (!is_complete())
+        return false;
+
+    chain::block block(header_, transactions_);
+
+    if (!block.is_valid_merkle_root())
+        return false;
+
+    out = std::move(block);
+    return true;
+}
+
+} // namespace message
+} // namespace system
+} // namespace libbitcoin
@@ -19,6 +19,7 @@
 #include <bitcoin/system/message/send_headers.hpp>
 
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -97,8 +98,8 @@ void send_headers::reset()
 
 bool send_headers::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool send_headers::from_data(uint32_t version, std::istream& stream)
@@ -142,6 +143,10 @@ void send_headers::to_data(uint32_t, std::ostream&) const
 {
 }
 
+void send_headers::to_data(uint32_t, writer&) const
+{
+}
+
 size_t send_headers::serialized_size(uint32_t version) const
 {
     return send_headers::satoshi_fixed_size(version);
@@ -19,6 +19,7 @@
 #include <bitcoin/system/message/verack.hpp>
 
 #include <bitcoin/system/message/version.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -68,8 +69,8 @@ void verack::reset()
 
 bool verack::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool verack::from_data(uint32_t version, std::istream& stream)
@@ -100,6 +101,10 @@ void verack::to_data(uint32_t, std::ostream&) const
 {
 }
 
+void verack::to_data(uint32_t, writer&) const
+{
+}
+
 size_t verack::serialized_size(uint32_t version) const
 {
     return verack::satoshi_fixed_size(version);
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <bitcoin/system/message/messages.hpp>
+#include <bitcoin/system/utility/byte_reader.hpp>
 #include <bitcoin/system/utility/container_sink.hpp>
 #include <bitcoin/system/utility/container_source.hpp>
 #include <bitcoin/system/utility/istream_reader.hpp>
@@ -133,8 +134,8 @@ void version::reset()
 
 bool version::from_data(uint32_t version, const data_chunk& data)
 {
-    data_source istream(data);
-    return from_data(version, istream);
+    byte_reader source(data);
+    return from_data(version, source);
 }
 
 bool version::from_data(uint32_t version, std::istream& stream)
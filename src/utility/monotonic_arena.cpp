@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/utility/monotonic_arena.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <bitcoin/system/compat.hpp>
+#include <bitcoin/system/utility/assert.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+const size_t monotonic_arena::default_alignment =
+    std::alignment_of<std::max_align_t>::value;
+
+monotonic_arena::monotonic_arena(size_t initial_capacity)
+  : next_capacity_(std::max(initial_capacity, size_t(1))),
+    capacity_(0),
+    size_(0),
+    position_(nullptr),
+    end_(nullptr)
+{
+}
+
+void* monotonic_arena::allocate(size_t bytes, size_t alignment)
+{
+    BITCOIN_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    BITCOIN_ASSERT(alignment <= default_alignment);
+
+    const auto address = reinterpret_cast<uintptr_t>(position_);
+    const auto remaining = static_cast<size_t>(end_ - position_);
+    auto padding = (alignment - (address % alignment)) % alignment;
+
+    if (position_ == nullptr || padding > remaining ||
+        bytes > remaining - padding)
+    {
+        // New blocks are aligned for any scalar type.
+        grow(bytes);
+        padding = 0;
+    }
+
+    const auto result = position_ + padding;
+    position_ = result + bytes;
+    size_ += padding + bytes;
+    return result;
+}
+
+size_t monotonic_arena::blocks() const
+{
+    return blocks_.size();
+}
+
+size_t monotonic_arena::capacity() const
+{
+    return capacity_;
+}
+
+size_t monotonic_arena::size() const
+{
+    return size_;
+}
+
+// private
+void monotonic_arena::grow(size_t minimum)
+{
+    const auto size = std::max(next_capacity_, minimum);
+    blocks_.emplace_back(new uint8_t[size]);
+    position_ = blocks_.back().get();
+    end_ = position_ + size;
+    capacity_ += size;
+
+    // Doubling bounds the number of blocks logarithmically in total size.
+    if (next_capacity_ <= BC_MAX_SIZE / 2)
+        next_capacity_ *= 2;
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/utility/parallel_for.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/error.hpp>
+#include <bitcoin/system/utility/threadpool.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Indexes are claimed in order from a shared cursor by the calling thread and
+// by each pool job, so that idle threads take up any remaining work. Once an
+// index fails no subsequent index is claimed, though preceding indexes are
+// completed so that the lowest failure is the one reported.
+class work_cursor
+{
+public:
+    typedef std::shared_ptr<work_cursor> ptr;
+
+    work_cursor(size_t count, std::function<code(size_t)> work)
+      : count_(count), work_(std::move(work)), next_(0), failed_(max_size_t),
+        ec_(error::success), closed_(false), active_(0)
+    {
+    }
+
+    // Pool jobs that start after completion do not invoke work.
+    void join()
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (closed_)
+                return;
+
+            ++active_;
+        }
+        ///////////////////////////////////////////////////////////////////////
+
+        run();
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (--active_ == 0)
+            idle_.notify_one();
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    // The calling thread works until indexes are exhausted, and then waits on
+    // any pool jobs that are still working a claimed index.
+    code complete()
+    {
+        run();
+
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        std::unique_lock<std::mutex> lock(mutex_);
+        closed_ = true;
+        idle_.wait(lock, [this]() { return active_ == 0; });
+        return ec_;
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+private:
+    void run()
+    {
+        // Claims are ascending, so all claims following a failure also follow.
+        for (auto index = next_++; index < count_ && index < failed_.load();
+            index = next_++)
+        {
+            const auto ec = work_(index);
+
+            if (ec)
+                fail(index, ec);
+        }
+    }
+
+    void fail(size_t index, const code& ec)
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Critical Section
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (index < failed_.load())
+        {
+            failed_.store(index);
+            ec_ = ec;
+        }
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    // These are thread safe.
+    const size_t count_;
+    const std::function<code(size_t)> work_;
+    std::atomic<size_t> next_;
+    std::atomic<size_t> failed_;
+
+    // These are protected by mutex.
+    code ec_;
+    bool closed_;
+    size_t active_;
+    std::mutex mutex_;
+    std::condition_variable idle_;
+};
+
+code parallel_for(threadpool& pool, size_t count,
+    std::function<code(size_t)> work)
+{
+    const auto cursor = std::make_shared<work_cursor>(count, std::move(work));
+    const auto jobs = std::min(pool.size(), count);
+
+    // The calling thread also works, so one fewer job is required.
+    for (size_t job = 1; job < jobs; ++job)
+        pool.service().post([cursor]() { cursor->join(); });
+
+    return cursor->complete();
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -19,9 +19,14 @@
 #include <bitcoin/system/wallet/select_outputs.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <vector>
 #include <bitcoin/system/constants.hpp>
+#include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/utility/assert.hpp>
+#include <bitcoin/system/chain/points_index.hpp>
 #include <bitcoin/system/chain/points_value.hpp>
 
 namespace libbitcoin {
@@ -30,6 +35,9 @@ namespace wallet {
 
 using namespace bc::system::chain;
 
+// The branch and bound search is abandoned after this many steps.
+static const size_t branch_and_bound_tries = 100000;
+
 void select_outputs::greedy(points_value& out, const points_value& unspent,
     uint64_t minimum_value)
 {
@@ -79,12 +87,15 @@ void select_outputs::greedy(points_value& out, const points_value& unspent,
     // Sort all by descending value in order to use the fewest inputs possible.
     std::sort(copy.begin(), copy.end(), greater);
 
+    uint64_t total = 0;
+
     // This is naive, will not necessarily find the smallest combination.
     for (auto point = copy.begin(); point != copy.end(); ++point)
     {
         out.points.push_back(*point);
+        total += point->value();
 
-        if (out.value() >= minimum_value)
+        if (total >= minimum_value)
             return;
     }
 
@@ -112,11 +123,177 @@ void select_outputs::individual(points_value& out, const points_value& unspent,
     std::sort(out.points.begin(), out.points.end(), lesser);
 }
 
+void select_outputs::greedy(points_value& out, const points_index& unspent,
+    uint64_t minimum_value)
+{
+    out.points.clear();
+
+    // The minimum required value does not exist.
+    if (unspent.value() < minimum_value)
+        return;
+
+    // If there are values large enough, return the smallest (of the largest).
+    const auto minimum = unspent.lower_bound(minimum_value);
+
+    if (minimum != unspent.end())
+    {
+        out.points.push_back(*minimum);
+        return;
+    }
+
+    typedef std::reverse_iterator<points_index::const_iterator> descending;
+
+    // The fewest (largest) points that together satisfy the minimum, taken by
+    // descending value. The running total up to the partition is sufficiently
+    // small that the points from the partition forward are sufficient.
+    const auto first = unspent.partition_point(unspent.value() -
+        minimum_value);
+
+    out.points.assign(descending(unspent.end()), descending(first));
+}
+
+void select_outputs::individual(points_value& out,
+    const points_index& unspent, uint64_t minimum_value)
+{
+    // Select all individual points that satisfy the minimum, ascending.
+    out.points.assign(unspent.lower_bound(minimum_value), unspent.end());
+}
+
+void select_outputs::branch_and_bound(points_value& out,
+    const points_index& unspent, uint64_t minimum_value, uint64_t input_fee,
+    uint64_t cost_of_change)
+{
+    out.points.clear();
+    const auto maximum_value = ceiling_add(minimum_value, cost_of_change);
+
+    // Outputs that do not exceed the input fee have no effective value, and an
+    // output with effective value above the maximum cannot be in a solution.
+    const auto first = unspent.upper_bound(input_fee);
+    const auto last = unspent.upper_bound(ceiling_add(maximum_value,
+        input_fee));
+
+    // Candidates are searched in descending order of effective value.
+    std::vector<const point_value*> candidates;
+    candidates.reserve(std::distance(first, last));
+
+    for (auto point = last; point != first;)
+        candidates.push_back(&*--point);
+
+    const auto count = candidates.size();
+    const auto effective = [&](size_t index)
+    {
+        return candidates[index]->value() - input_fee;
+    };
+
+    // The effective value of all candidates at or after each depth.
+    std::vector<uint64_t> remaining(count + 1, 0);
+
+    for (auto index = count; index-- > 0;)
+        remaining[index] = ceiling_add(remaining[index + 1], effective(index));
+
+    if (remaining.front() < minimum_value)
+        return;
+
+    std::vector<size_t> selection;
+    std::vector<size_t> best;
+    auto best_excess = max_uint64;
+    uint64_t value = 0;
+    size_t depth = 0;
+
+    for (size_t tries = 0; tries < branch_and_bound_tries; ++tries)
+    {
+        auto backtrack = false;
+
+        // The branch cannot reach the minimum or has exceeded the maximum.
+        if (ceiling_add(value, remaining[depth]) < minimum_value ||
+            value > maximum_value)
+        {
+            backtrack = true;
+        }
+        else if (value >= minimum_value)
+        {
+            const auto excess = value - minimum_value;
+
+            if (excess < best_excess)
+            {
+                best_excess = excess;
+                best = selection;
+
+                // An exact match cannot be improved upon.
+                if (excess == 0)
+                    break;
+            }
+
+            backtrack = true;
+        }
+
+        // Include the candidate at the current depth.
+        if (!backtrack)
+        {
+            selection.push_back(depth);
+            value += effective(depth);
+            ++depth;
+            continue;
+        }
+
+        if (selection.empty())
+            break;
+
+        // Exclude the most recent inclusion. Candidates of equal value that
+        // follow are also excluded, as the inclusion branch covered them.
+        const auto excluded = selection.back();
+        selection.pop_back();
+        value -= effective(excluded);
+
+        depth = excluded + 1;
+
+        while (depth < count && effective(depth) == effective(excluded))
+            ++depth;
+    }
+
+    out.points.reserve(best.size());
+
+    for (const auto index: best)
+        out.points.push_back(*candidates[index]);
+}
+
 void select_outputs::select(points_value& out, const points_value& unspent,
     uint64_t minimum_value, algorithm option)
 {
     switch(option)
     {
+        case algorithm::branch_and_bound:
+        {
+            branch_and_bound(out, points_index(unspent.points), minimum_value,
+                0, 0);
+            break;
+        }
+        case algorithm::individual:
+        {
+            individual(out, unspent, minimum_value);
+            break;
+        }
+        case algorithm::greedy:
+        default:
+        {
+            greedy(out, unspent, minimum_value);
+            break;
+        }
+    }
+}
+
+void select_outputs::select(points_value& out, const points_index& unspent,
+    uint64_t minimum_value, algorithm option, uint64_t input_fee,
+    uint64_t cost_of_change)
+{
+    switch(option)
+    {
+        case algorithm::branch_and_bound:
+        {
+            branch_and_bound(out, unspent, minimum_value, input_fee,
+                cost_of_change);
+            break;
+        }
         case algorithm::individual:
         {
             individual(out, unspent, minimum_value);
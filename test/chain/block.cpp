@@ -787,4 +787,91 @@ BOOST_AUTO_TEST_CASE(block__is_internal_double_spend__nonunique_prevouts__true)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(block_connect_tests)
+
+static const config::checkpoint::list no_checkpoints{};
+
+static chain::chain_state test_state()
+{
+    chain::chain_state::data values;
+    values.height = 1;
+    values.bits.self = 0x1d00ffff;
+    values.bits.ordered.push_back(0x1d00ffff);
+    values.version.self = 1;
+    values.timestamp.self = 1231006505;
+    values.timestamp.retarget = 1231006505;
+    values.timestamp.ordered.push_back(1231006505);
+    const settings settings(config::settings::mainnet);
+    return{ std::move(values), no_checkpoints, machine::rule_fork::no_rules,
+        0, settings };
+}
+
+// Each input spends a prevout that is satisfied only if its index is not bad.
+static chain::block test_block(size_t transactions, size_t inputs,
+    const std::vector<size_t>& bad)
+{
+    chain::transaction::list tx_list;
+    size_t position = 0;
+
+    for (size_t tx = 0; tx < transactions; ++tx)
+    {
+        chain::transaction instance;
+
+        for (size_t input = 0; input < inputs; ++input, ++position)
+        {
+            const auto fail = std::find(bad.begin(), bad.end(), position) !=
+                bad.end();
+            const auto code = fail ? machine::opcode::push_size_0 :
+                machine::opcode::push_positive_1;
+            const chain::script script{ { machine::operation{ code } } };
+            chain::output_point prevout{ null_hash, static_cast<uint32_t>(position) };
+            prevout.metadata.cache = chain::output{ 0, script };
+            instance.inputs().emplace_back(prevout, chain::script{}, 0);
+        }
+
+        tx_list.push_back(instance);
+    }
+
+    chain::block instance;
+    instance.set_transactions(tx_list);
+    return instance;
+}
+
+BOOST_AUTO_TEST_CASE(block__connect_transactions__pool_all_valid__success)
+{
+    threadpool pool(4);
+    const auto state = test_state();
+    const auto instance = test_block(10, 20, {});
+    BOOST_REQUIRE_EQUAL(instance.connect_transactions(state), error::success);
+    BOOST_REQUIRE_EQUAL(instance.connect_transactions(state, pool), error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block__connect_transactions__empty_pool_invalid__same_as_sequential)
+{
+    threadpool pool;
+    const auto state = test_state();
+    const auto instance = test_block(3, 3, { 5 });
+    const auto expected = instance.connect_transactions(state);
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_EQUAL(instance.connect_transactions(state, pool), expected);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect_transactions__pool_missing_previous_output__first_failure)
+{
+    threadpool pool(4);
+    const auto state = test_state();
+    const auto instance = test_block(10, 20, { 150 });
+
+    // An earlier input with an unpopulated prevout takes precedence.
+    instance.transactions()[7].inputs()[3].previous_output().metadata.cache = {};
+    BOOST_REQUIRE_EQUAL(instance.connect_transactions(state), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(instance.connect_transactions(state, pool), error::missing_previous_output);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
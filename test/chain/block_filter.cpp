@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(block_filter_tests)
+
+static chain::script pay_to(uint8_t seed)
+{
+    short_hash hash;
+    hash.fill(seed);
+    return { chain::script::to_pay_key_hash_pattern(hash) };
+}
+
+// A coinbase paying the seeded scripts, and a spend of each prior output.
+static chain::block make_block(uint8_t seed, const chain::output::list& spent)
+{
+    const chain::input coinbase(chain::output_point(null_hash,
+        chain::point::null_index), chain::script{}, 0);
+    const chain::transaction first(1u, seed, { coinbase },
+        { { 50, pay_to(seed) }, { 0, chain::script{} } });
+
+    chain::transaction::list transactions{ first };
+
+    for (uint32_t index = 0; index < spent.size(); ++index)
+    {
+        chain::input input(chain::output_point(first.hash(), index),
+            chain::script{}, 0);
+        input.previous_output().metadata.cache = spent[index];
+        transactions.emplace_back(1u, index, chain::input::list{ input },
+            chain::output::list{ { 1, pay_to(seed + index + 1u) } });
+    }
+
+    chain::block out;
+    out.set_transactions(transactions);
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__constructor__testnet_genesis__bip158_vector)
+{
+    const chain::block genesis = settings(config::settings::testnet).genesis_block;
+    const chain::block_filter instance(genesis);
+    BOOST_REQUIRE_EQUAL(encode_base16(instance.encoded()), "019dfca8");
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.header(null_hash)),
+        "21584579b7eb08997773e5aeff3a7f932700042d0ed2a6129012b7d7ae81b750");
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__constructor__no_elements__zero_count)
+{
+    const chain::input coinbase(chain::output_point(null_hash,
+        chain::point::null_index), chain::script{}, 0);
+    const chain::transaction tx(1u, 0u, { coinbase }, { { 0, chain::script{} } });
+    chain::block block;
+    block.set_transactions({ tx });
+
+    const chain::block_filter instance(block);
+    BOOST_REQUIRE(instance.encoded() == data_chunk{ 0x00 });
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(!instance.match(pay_to(1).to_data(false)));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__constructor__spent_outputs__elements_match)
+{
+    const chain::output::list spent{ { 1, pay_to(100) }, { 2, pay_to(101) } };
+    const auto block = make_block(1, spent);
+    const chain::block_filter instance(block, spent);
+
+    // The coinbase output, two spend outputs and two spent outputs.
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE(instance.match(pay_to(1).to_data(false)));
+    BOOST_REQUIRE(instance.match(pay_to(2).to_data(false)));
+    BOOST_REQUIRE(instance.match(pay_to(3).to_data(false)));
+    BOOST_REQUIRE(instance.match(pay_to(100).to_data(false)));
+    BOOST_REQUIRE(instance.match(pay_to(101).to_data(false)));
+    BOOST_REQUIRE(!instance.match(pay_to(4).to_data(false)));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__constructor__cached_previous_outputs__same_as_spent)
+{
+    const chain::output::list spent{ { 1, pay_to(100) }, { 2, pay_to(101) } };
+    const auto block = make_block(1, spent);
+    BOOST_REQUIRE(chain::block_filter(block) == chain::block_filter(block, spent));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__constructor__duplicate_and_null_data__excluded)
+{
+    // The spent output script duplicates the coinbase output script.
+    const chain::script null_data(chain::script::to_pay_null_data_pattern(
+        data_chunk{ 0x42 }));
+    const chain::output::list spent{ { 1, pay_to(1) }, { 2, null_data } };
+    const auto block = make_block(1, spent);
+    const chain::block_filter instance(block, spent);
+
+    // Null data is excluded only as an output of the block.
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE(instance.match(null_data.to_data(false)));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__match__any_of_many__single_pass)
+{
+    const chain::output::list spent{ { 1, pay_to(100) } };
+    const chain::block_filter instance(make_block(1, spent), spent);
+
+    data_stack queries;
+    for (uint8_t seed = 150; seed < 250; ++seed)
+        queries.push_back(pay_to(seed).to_data(false));
+
+    BOOST_REQUIRE(!instance.match(queries));
+    queries.push_back(pay_to(100).to_data(false));
+    BOOST_REQUIRE(instance.match(queries));
+    BOOST_REQUIRE(!instance.match(data_stack{}));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__match__encoded_roundtrip__equal)
+{
+    const chain::output::list spent{ { 1, pay_to(100) }, { 2, pay_to(101) } };
+    const auto block = make_block(7, spent);
+    const chain::block_filter built(block, spent);
+    const chain::block_filter instance(block.hash(), built.encoded());
+    BOOST_REQUIRE(instance == built);
+    BOOST_REQUIRE(instance.match(pay_to(101).to_data(false)));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__headers__chain__each_commits_to_previous)
+{
+    const chain::output::list spent{ { 1, pay_to(100) } };
+    const chain::block_filter::list filters
+    {
+        { make_block(1, spent), spent },
+        { make_block(2, spent), spent },
+        { make_block(3, spent), spent }
+    };
+
+    const auto headers = chain::block_filter::headers(filters, null_hash);
+    BOOST_REQUIRE_EQUAL(headers.size(), 3u);
+    BOOST_REQUIRE(headers[0] == filters[0].header(null_hash));
+    BOOST_REQUIRE(headers[1] == filters[1].header(headers[0]));
+    BOOST_REQUIRE(headers[2] == filters[2].header(headers[1]));
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__basic_filters__pool__same_as_sequential)
+{
+    threadpool pool(4);
+    const chain::output::list spent{ { 1, pay_to(100) }, { 2, pay_to(101) } };
+    chain::block::list blocks;
+
+    for (uint8_t seed = 0; seed < 20; ++seed)
+        blocks.push_back(make_block(seed, spent));
+
+    const auto filters = chain::block_filter::basic_filters(blocks, pool);
+    BOOST_REQUIRE_EQUAL(filters.size(), blocks.size());
+
+    for (size_t index = 0; index < blocks.size(); ++index)
+        BOOST_REQUIRE(filters[index] == chain::block_filter(blocks[index]));
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(block_filter__basic_filters__empty_pool__same_as_sequential)
+{
+    threadpool pool;
+    const chain::output::list spent{ { 1, pay_to(100) } };
+    const chain::block::list blocks{ make_block(1, spent), make_block(2, spent) };
+    const auto filters = chain::block_filter::basic_filters(blocks, pool);
+    BOOST_REQUIRE_EQUAL(filters.size(), 2u);
+    BOOST_REQUIRE(filters[0] == chain::block_filter(blocks[0]));
+    BOOST_REQUIRE(filters[1] == chain::block_filter(blocks[1]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
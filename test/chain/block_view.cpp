@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc;
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(chain_block_view_tests)
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__default__invalid)
+{
+    const chain::block_view instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.transactions().empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__factory__insufficient_data__invalid)
+{
+    const chain::block genesis = settings(config::settings::mainnet).genesis_block;
+    auto data = genesis.to_data();
+    data.pop_back();
+    const auto instance = chain::block_view::factory(std::move(data));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__factory__genesis_mainnet__same_as_block)
+{
+    const chain::block genesis = settings(config::settings::mainnet).genesis_block;
+    const auto instance = chain::block_view::factory(genesis.to_data());
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), genesis.serialized_size());
+    BOOST_REQUIRE(instance.header() == genesis.header());
+    BOOST_REQUIRE(instance.hash() == genesis.hash());
+    BOOST_REQUIRE_EQUAL(instance.transactions().size(), 1u);
+    BOOST_REQUIRE(instance.transactions().front().is_coinbase());
+    BOOST_REQUIRE(instance.transactions().front().hash() ==
+        genesis.transactions().front().hash());
+    BOOST_REQUIRE(instance.generate_merkle_root() == genesis.generate_merkle_root());
+    BOOST_REQUIRE(instance.is_valid_merkle_root());
+    BOOST_REQUIRE(instance.to_block() == genesis);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
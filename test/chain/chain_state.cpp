@@ -26,6 +26,7 @@ BOOST_AUTO_TEST_SUITE(chain_chain_state_tests)
 struct test_chain_state: chain::chain_state
 {
     using chain::chain_state::work_required;
+    using chain::chain_state::median_time_past;
 };
 
 chain::chain_state::data get_values(size_t retargeting_interval)
@@ -58,4 +59,35 @@ BOOST_AUTO_TEST_CASE(chain_state__work_required_retarget__overflow_patch_enabled
     BOOST_REQUIRE_EQUAL(work, settings.proof_of_work_limit);
 }
 
+BOOST_AUTO_TEST_CASE(chain_state__median_time_past__empty__zero)
+{
+    const chain::chain_state::data values{};
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, 0), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__median_time_past__unordered__modulo_two_median)
+{
+    chain::chain_state::data values{};
+    const uint32_t times[] = { 9, 3, 7, 1, 11, 5, 2, 8, 10, 4, 6 };
+
+    for (const auto time: times)
+        values.timestamp.ordered.push_back(time);
+
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, 0), 6u);
+    values.timestamp.ordered.pop_front();
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, 0), 6u);
+    values.timestamp.ordered.pop_front();
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, 0), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__median_time_past__oversized__median)
+{
+    chain::chain_state::data values{};
+
+    for (uint32_t time = 20; time > 0; --time)
+        values.timestamp.ordered.push_back(time);
+
+    BOOST_REQUIRE_EQUAL(test_chain_state::median_time_past(values, 0), 11u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+using namespace bc::system::chain;
+
+BOOST_AUTO_TEST_SUITE(points_index_tests)
+
+static const point_value::list unordered
+{
+    { { null_hash, 0u }, 42u },
+    { { null_hash, 1u }, 10u },
+    { { null_hash, 2u }, 30u },
+    { { null_hash, 3u }, 10u }
+};
+
+BOOST_AUTO_TEST_CASE(points_index__construct__default__empty)
+{
+    const points_index instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.value(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__construct__unordered__ascending_by_value)
+{
+    const points_index instance(unordered);
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.value(), 92u);
+
+    auto it = instance.begin();
+    BOOST_REQUIRE_EQUAL((it++)->value(), 10u);
+    BOOST_REQUIRE_EQUAL((it++)->value(), 10u);
+    BOOST_REQUIRE_EQUAL((it++)->value(), 30u);
+    BOOST_REQUIRE_EQUAL((it++)->value(), 42u);
+    BOOST_REQUIRE(it == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__insert__middle__ordered_and_valued)
+{
+    points_index instance(unordered);
+    instance.insert({ { null_hash, 4u }, 20u });
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.value(), 112u);
+    BOOST_REQUIRE_EQUAL(instance.lower_bound(11u)->value(), 20u);
+    BOOST_REQUIRE_EQUAL(instance.lower_bound(11u)->index(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__erase__present__removed)
+{
+    points_index instance(unordered);
+    BOOST_REQUIRE(instance.erase({ { null_hash, 3u }, 10u }));
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.value(), 82u);
+    BOOST_REQUIRE_EQUAL(instance.begin()->index(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__erase__missing__false)
+{
+    points_index instance(unordered);
+    BOOST_REQUIRE(!instance.erase({ { null_hash, 5u }, 10u }));
+    BOOST_REQUIRE(!instance.erase({ { null_hash, 0u }, 41u }));
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.value(), 92u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__bounds__values__expected)
+{
+    const points_index instance(unordered);
+    BOOST_REQUIRE_EQUAL(instance.lower_bound(10u)->value(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.upper_bound(10u)->value(), 30u);
+    BOOST_REQUIRE_EQUAL(instance.lower_bound(31u)->value(), 42u);
+    BOOST_REQUIRE(instance.lower_bound(43u) == instance.end());
+    BOOST_REQUIRE(instance.upper_bound(42u) == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__value__positions__preceding_totals)
+{
+    const points_index instance(unordered);
+    auto it = instance.begin();
+    BOOST_REQUIRE_EQUAL(instance.value(it++), 0u);
+    BOOST_REQUIRE_EQUAL(instance.value(it++), 10u);
+    BOOST_REQUIRE_EQUAL(instance.value(it++), 20u);
+    BOOST_REQUIRE_EQUAL(instance.value(it++), 50u);
+    BOOST_REQUIRE_EQUAL(instance.value(it), 92u);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__partition_point__totals__expected)
+{
+    const points_index instance(unordered);
+    BOOST_REQUIRE_EQUAL(instance.partition_point(0u)->value(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.partition_point(19u)->value(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.partition_point(20u)->value(), 30u);
+    BOOST_REQUIRE_EQUAL(instance.partition_point(50u)->value(), 42u);
+    BOOST_REQUIRE(instance.partition_point(92u) == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__iterate__reverse__descending)
+{
+    const points_index instance(unordered);
+    auto it = instance.end();
+    BOOST_REQUIRE_EQUAL((--it)->value(), 42u);
+    BOOST_REQUIRE_EQUAL((--it)->value(), 30u);
+    BOOST_REQUIRE_EQUAL((--it)->value(), 10u);
+    BOOST_REQUIRE_EQUAL((--it)->value(), 10u);
+    BOOST_REQUIRE(it == instance.begin());
+}
+
+BOOST_AUTO_TEST_CASE(points_index__insert_erase__many__consistent)
+{
+    points_index instance;
+    point_value::list expected;
+
+    // Values repeat so that equal values are ordered by point.
+    for (uint32_t index = 0; index < 500u; ++index)
+    {
+        const point_value point{ { null_hash, index }, (index * 7919u) % 97u };
+        instance.insert(point);
+        expected.push_back(point);
+    }
+
+    for (uint32_t index = 0; index < 500u; index += 3)
+    {
+        const point_value point{ { null_hash, index }, (index * 7919u) % 97u };
+        BOOST_REQUIRE(instance.erase(point));
+        BOOST_REQUIRE(!instance.erase(point));
+        expected.erase(std::find(expected.begin(), expected.end(), point));
+    }
+
+    std::sort(expected.begin(), expected.end(),
+        [](const point_value& left, const point_value& right)
+        {
+            return left.value() < right.value() || (left.value() ==
+                right.value() && left.index() < right.index());
+        });
+
+    BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+    BOOST_REQUIRE(std::equal(expected.begin(), expected.end(),
+        instance.begin()));
+
+    uint64_t total = 0;
+    auto it = instance.begin();
+
+    for (const auto& point: expected)
+    {
+        BOOST_REQUIRE_EQUAL(instance.value(it++), total);
+        total += point.value();
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.value(), total);
+}
+
+BOOST_AUTO_TEST_CASE(points_index__clear__populated__empty)
+{
+    points_index instance(unordered);
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.value(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
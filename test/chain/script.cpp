@@ -667,6 +667,88 @@ BOOST_AUTO_TEST_CASE(script__generate_signature_hash__all__expected)
     BOOST_REQUIRE_EQUAL(result, expected);
 }
 
+// bip143 native p2wpkh example, signature hashes of the second input.
+#define BIP143_P2WPKH_TX "0100000002fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f0000000000eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac11000000"
+#define BIP143_P2WPKH_CODE "dup hash160 [1d0f172a0ecb48aee1be1f2687d2963ae33f71a1] equalverify checksig"
+#define BIP143_P2WPKH_VALUE 600000000
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__version_0_all__expected)
+{
+    data_chunk tx_data;
+    decode_base16(tx_data, BIP143_P2WPKH_TX);
+    transaction new_tx;
+    BOOST_REQUIRE(new_tx.from_data(tx_data));
+
+    script script_code;
+    BOOST_REQUIRE(script_code.from_string(BIP143_P2WPKH_CODE));
+
+    const auto index = 1u;
+    const auto sighash_type = sighash_algorithm::all;
+    const auto expected = "c37af31116d1b27caf68aae9e3ac82f1477929014d5b917657d0eb49478cb670";
+    const auto sighash1 = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+    BOOST_REQUIRE_EQUAL(encode_base16(sighash1), expected);
+
+    // The second hash is generated from the cached midstate.
+    const auto sighash2 = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+    BOOST_REQUIRE_EQUAL(encode_base16(sighash2), expected);
+}
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__version_0_none__expected)
+{
+    data_chunk tx_data;
+    decode_base16(tx_data, BIP143_P2WPKH_TX);
+    transaction new_tx;
+    BOOST_REQUIRE(new_tx.from_data(tx_data));
+
+    script script_code;
+    BOOST_REQUIRE(script_code.from_string(BIP143_P2WPKH_CODE));
+
+    const auto index = 1u;
+    const auto sighash_type = sighash_algorithm::none;
+    const auto sighash = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+    BOOST_REQUIRE_EQUAL(encode_base16(sighash), "6ff11a9b87fb510a3a31af006bd3811b632f8a39d88a2bfda49cee203dcc356e");
+}
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__version_0_anyone_can_pay_single__expected)
+{
+    data_chunk tx_data;
+    decode_base16(tx_data, BIP143_P2WPKH_TX);
+    transaction new_tx;
+    BOOST_REQUIRE(new_tx.from_data(tx_data));
+
+    script script_code;
+    BOOST_REQUIRE(script_code.from_string(BIP143_P2WPKH_CODE));
+
+    const auto index = 1u;
+    const auto sighash_type = sighash_algorithm::single | sighash_algorithm::anyone_can_pay;
+    const auto sighash = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+    BOOST_REQUIRE_EQUAL(encode_base16(sighash), "79ff9ff708f79ce8f7a4f90d62028533a99d7340b7fb3d819dfd9a599a78e39c");
+}
+
+BOOST_AUTO_TEST_CASE(script__generate_signature_hash__version_0_midstate_invalidated__expected)
+{
+    data_chunk tx_data;
+    decode_base16(tx_data, BIP143_P2WPKH_TX);
+    transaction new_tx;
+    BOOST_REQUIRE(new_tx.from_data(tx_data));
+
+    script script_code;
+    BOOST_REQUIRE(script_code.from_string(BIP143_P2WPKH_CODE));
+
+    const auto index = 1u;
+    const auto sighash_type = sighash_algorithm::all;
+    const auto sighash1 = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+
+    // Changing the version must not reuse the cached midstate.
+    new_tx.set_version(2);
+    const auto sighash2 = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+    BOOST_REQUIRE(sighash1 != sighash2);
+
+    new_tx.set_version(1);
+    const auto sighash3 = script::generate_signature_hash(new_tx, index, script_code, sighash_type, script_version::zero, BIP143_P2WPKH_VALUE);
+    BOOST_REQUIRE(sighash1 == sighash3);
+}
+
 // Ad-hoc test cases.
 //-----------------------------------------------------------------------------
 
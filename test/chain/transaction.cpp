@@ -509,6 +509,68 @@ BOOST_AUTO_TEST_CASE(transaction__factory_data_1__case_2__success)
     BOOST_REQUIRE(resave == raw_tx);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__hashes__uncached_and_cached__expected)
+{
+    const auto tx1 = chain::transaction::factory(to_chunk(base16_literal(TX1)));
+    const auto tx4 = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    const chain::transaction::list txs{ tx1, tx4, tx1, tx4, tx1 };
+    BOOST_REQUIRE(chain::transaction::hashes({}).empty());
+
+    // Uncached hashes are computed as a batch and then cached.
+    const auto hashes = chain::transaction::hashes(txs);
+    BOOST_REQUIRE_EQUAL(hashes.size(), txs.size());
+    BOOST_REQUIRE(hashes[0] == hash_literal(TX1_HASH));
+    BOOST_REQUIRE(hashes[1] == hash_literal(TX4_HASH));
+    BOOST_REQUIRE(hashes[4] == hash_literal(TX1_HASH));
+    BOOST_REQUIRE(chain::transaction::hashes(txs) == hashes);
+    BOOST_REQUIRE(txs[3].hash() == hash_literal(TX4_HASH));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__freeze__unfrozen__frozen_expected_hash)
+{
+    const auto instance = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    BOOST_REQUIRE(!instance.is_frozen());
+    instance.freeze();
+    BOOST_REQUIRE(instance.is_frozen());
+    BOOST_REQUIRE(instance.hash() == hash_literal(TX4_HASH));
+    BOOST_REQUIRE(instance.hash(true) == hash_literal(TX4_HASH));
+    BOOST_REQUIRE_EQUAL(instance.is_segregated(), false);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__freeze__copy__frozen_expected_hash)
+{
+    const auto instance = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    instance.freeze();
+    const chain::transaction copy(instance);
+    BOOST_REQUIRE(copy.is_frozen());
+    BOOST_REQUIRE(copy.hash() == hash_literal(TX4_HASH));
+    BOOST_REQUIRE_EQUAL(copy.total_output_value(), instance.total_output_value());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__freeze__set_version__thawed_new_hash)
+{
+    auto instance = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    instance.freeze();
+    instance.set_version(instance.version() + 1);
+    BOOST_REQUIRE(!instance.is_frozen());
+    BOOST_REQUIRE(instance.hash() != hash_literal(TX4_HASH));
+    instance.set_version(instance.version() - 1);
+    BOOST_REQUIRE(instance.hash() == hash_literal(TX4_HASH));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__is_segregated__witness_set_through_inputs__serialized_with_witness)
+{
+    auto instance = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    BOOST_REQUIRE(!instance.is_segregated());
+    const auto size = instance.serialized_size(true, true);
+    BOOST_REQUIRE_EQUAL(size, instance.serialized_size(true, false));
+
+    instance.inputs()[0].set_witness(chain::witness(data_stack{ { 0x42 } }));
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE_GT(instance.serialized_size(true, true), size);
+    BOOST_REQUIRE_EQUAL(instance.to_data(true, true).size(), instance.serialized_size(true, true));
+}
+
 BOOST_AUTO_TEST_CASE(transaction__factory_data_2__case_1__success)
 {
     static const auto tx_hash = hash_literal(TX1_HASH);
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc;
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(chain_transaction_view_tests)
+
+#define TX4 \
+"010000000364e62ad837f29617bafeae951776e7a6b3019b2da37827921548d1" \
+"a5efcf9e5c010000006b48304502204df0dc9b7f61fbb2e4c8b0e09f3426d625" \
+"a0191e56c48c338df3214555180eaf022100f21ac1f632201154f3c69e1eadb5" \
+"9901a34c40f1127e96adc31fac6ae6b11fb4012103893d5a06201d5cf61400e9" \
+"6fa4a7514fc12ab45166ace618d68b8066c9c585f9ffffffff54b755c39207d4" \
+"43fd96a8d12c94446a1c6f66e39c95e894c23418d7501f681b010000006b4830" \
+"4502203267910f55f2297360198fff57a3631be850965344370f732950b47795" \
+"737875022100f7da90b82d24e6e957264b17d3e5042bab8946ee5fc676d15d91" \
+"5da450151d36012103893d5a06201d5cf61400e96fa4a7514fc12ab45166ace6" \
+"18d68b8066c9c585f9ffffffff0aa14d394a1f0eaf0c4496537f8ab9246d9663" \
+"e26acb5f308fccc734b748cc9c010000006c493046022100d64ace8ec2d5feeb" \
+"3e868e82b894202db8cb683c414d806b343d02b7ac679de7022100a2dcd39940" \
+"dd28d4e22cce417a0829c1b516c471a3d64d11f2c5d754108bdc0b012103893d" \
+"5a06201d5cf61400e96fa4a7514fc12ab45166ace618d68b8066c9c585f9ffff" \
+"ffff02c0e1e400000000001976a914884c09d7e1f6420976c40e040c30b2b622" \
+"10c3d488ac20300500000000001976a914905f933de850988603aafeeb2fd7fc" \
+"e61e66fe5d88ac00000000"
+
+#define TX4_HASH \
+"8a6d9302fbe24f0ec756a94ecfc837eaffe16c43d1e68c62dfe980d99eea556f"
+
+// Test helper.
+static chain::transaction segregated_tx4()
+{
+    auto tx = chain::transaction::factory(to_chunk(base16_literal(TX4)));
+    auto inputs = tx.inputs();
+    inputs[1].set_witness(chain::witness(data_stack{ { 0x2a }, { 0x01, 0x02 } }));
+    tx.set_inputs(inputs);
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__default__invalid)
+{
+    const chain::transaction_view instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__factory__insufficient_data__invalid)
+{
+    auto data = to_chunk(base16_literal(TX4));
+    data.pop_back();
+    const auto instance = chain::transaction_view::factory(std::move(data));
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__factory__tx4__same_as_transaction)
+{
+    const auto data = to_chunk(base16_literal(TX4));
+    const auto tx = chain::transaction::factory(data);
+    const auto instance = chain::transaction_view::factory(data_chunk(data));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(!instance.is_coinbase());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), data.size());
+    BOOST_REQUIRE_EQUAL(instance.version(), tx.version());
+    BOOST_REQUIRE_EQUAL(instance.locktime(), tx.locktime());
+    BOOST_REQUIRE_EQUAL(instance.inputs_size(), tx.inputs().size());
+    BOOST_REQUIRE_EQUAL(instance.outputs_size(), tx.outputs().size());
+
+    for (size_t index = 0; index < tx.inputs().size(); ++index)
+    {
+        const auto& input = tx.inputs()[index];
+        BOOST_REQUIRE(instance.previous_output(index) == input.previous_output());
+        BOOST_REQUIRE(to_chunk(instance.input_script(index)) == input.script().to_data(false));
+        BOOST_REQUIRE_EQUAL(instance.sequence(index), input.sequence());
+        BOOST_REQUIRE(instance.witness(index).empty());
+    }
+
+    for (size_t index = 0; index < tx.outputs().size(); ++index)
+    {
+        const auto& output = tx.outputs()[index];
+        BOOST_REQUIRE_EQUAL(instance.output_value(index), output.value());
+        BOOST_REQUIRE(to_chunk(instance.output_script(index)) == output.script().to_data(false));
+    }
+
+    BOOST_REQUIRE(instance.hash() == hash_literal(TX4_HASH));
+    BOOST_REQUIRE(instance.hash(true) == hash_literal(TX4_HASH));
+    BOOST_REQUIRE(instance.to_transaction() == tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__from_data__offset__success)
+{
+    const auto tx = to_chunk(base16_literal(TX4));
+    const auto buffer = std::make_shared<const data_chunk>(build_chunk({ tx, tx }));
+    chain::transaction_view instance;
+    BOOST_REQUIRE(instance.from_data(buffer, tx.size()));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), tx.size());
+    BOOST_REQUIRE(instance.hash() == hash_literal(TX4_HASH));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__copy_assign__arena_target__target_arena_unused)
+{
+    // The target has no inputs or outputs, so its arena is not yet used.
+    const auto buffer = std::make_shared<const data_chunk>(to_chunk(base16_literal(TX4)));
+    const auto empty = std::make_shared<const data_chunk>(to_chunk(base16_literal("01000000000000000000")));
+    const auto source_arena = std::make_shared<monotonic_arena>();
+    const auto target_arena = std::make_shared<monotonic_arena>();
+    chain::transaction_view source;
+    chain::transaction_view target;
+    BOOST_REQUIRE(source.from_data(buffer, 0, source_arena));
+    BOOST_REQUIRE(target.from_data(empty, 0, target_arena));
+    BOOST_REQUIRE_EQUAL(target.inputs_size(), 0u);
+    const auto source_size = source_arena->size();
+    const auto target_size = target_arena->size();
+
+    target = source;
+    BOOST_REQUIRE(target.hash() == hash_literal(TX4_HASH));
+    BOOST_REQUIRE_EQUAL(source_arena->size(), source_size);
+    BOOST_REQUIRE_EQUAL(target_arena->size(), target_size);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__factory__segregated__same_as_transaction)
+{
+    const auto tx = segregated_tx4();
+    const auto instance = chain::transaction_view::factory(tx.to_data(true, true));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(), tx.serialized_size(true, true));
+    BOOST_REQUIRE(instance.witness(0).empty());
+    BOOST_REQUIRE(to_chunk(instance.witness(1)) == tx.inputs()[1].witness().to_data(true));
+    BOOST_REQUIRE(instance.hash() == hash_literal(TX4_HASH));
+    BOOST_REQUIRE(instance.hash() == tx.hash());
+    BOOST_REQUIRE(instance.hash(true) == tx.hash(true));
+    BOOST_REQUIRE(instance.to_transaction(true) == tx);
+    BOOST_REQUIRE(instance.to_transaction(true).hash(true) == tx.hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__hashes__mixed__same_as_hash)
+{
+    const chain::transaction_view::list instances
+    {
+        chain::transaction_view::factory(to_chunk(base16_literal(TX4))),
+        chain::transaction_view::factory(segregated_tx4().to_data(true, true))
+    };
+
+    const auto hashes = chain::transaction_view::hashes(instances);
+    BOOST_REQUIRE_EQUAL(hashes.size(), 2u);
+    BOOST_REQUIRE(hashes[0] == instances[0].hash());
+    BOOST_REQUIRE(hashes[1] == instances[1].hash());
+
+    const auto witness_hashes = chain::transaction_view::hashes(instances, true);
+    BOOST_REQUIRE(witness_hashes[0] == instances[0].hash(true));
+    BOOST_REQUIRE(witness_hashes[1] == instances[1].hash(true));
+    BOOST_REQUIRE(witness_hashes[1] != hashes[1]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -100,4 +100,73 @@ BOOST_AUTO_TEST_CASE(base58_array_test)
     BOOST_REQUIRE(converted == expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58__decode_base58__invalid_character__false_unchanged)
+{
+    data_chunk decoded{ 42 };
+    BOOST_REQUIRE(!decode_base58(decoded, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+    BOOST_REQUIRE(decoded == data_chunk{ 42 });
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__array_wrong_size__false)
+{
+    byte_array<24> short_array;
+    byte_array<26> long_array;
+    BOOST_REQUIRE(!decode_base58(short_array, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+    BOOST_REQUIRE(!decode_base58(long_array, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__extended_key_array__round_trip)
+{
+    const std::string key = "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi";
+    byte_array<82> converted;
+    BOOST_REQUIRE(decode_base58(converted, key));
+    BOOST_REQUIRE_EQUAL(encode_base58(converted), key);
+
+    data_chunk decoded;
+    BOOST_REQUIRE(decode_base58(decoded, key));
+    BOOST_REQUIRE(decoded == to_chunk(converted));
+    BOOST_REQUIRE_EQUAL(encode_base58(decoded), key);
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__caller_string__replaced)
+{
+    std::string encoded = "previous value that is longer than the result";
+    encode_base58(encoded, data_chunk{ 0x00, 0x61 });
+    BOOST_REQUIRE_EQUAL(encoded, "12g");
+    encode_base58(encoded, data_chunk{});
+    BOOST_REQUIRE(encoded.empty());
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__batch__round_trip)
+{
+    const data_stack data
+    {
+        {},
+        { 0x00, 0x00 },
+        { 0x61 },
+        { 0x00, 0xeb, 0x15, 0x23, 0x1d, 0xfc, 0xeb, 0x60, 0x92, 0x58, 0x86, 0xb6, 0x7d, 0x06, 0x52, 0x99, 0x92, 0x59, 0x15, 0xae, 0xb1, 0x72, 0xc0, 0x66, 0x47 },
+        data_chunk(300, 0xff)
+    };
+
+    string_list encoded{ "stale" };
+    encode_base58(encoded, data);
+    BOOST_REQUIRE_EQUAL(encoded.size(), data.size());
+    BOOST_REQUIRE_EQUAL(encoded[0], "");
+    BOOST_REQUIRE_EQUAL(encoded[1], "11");
+    BOOST_REQUIRE_EQUAL(encoded[2], "2g");
+    BOOST_REQUIRE_EQUAL(encoded[3], "1NS17iag9jJgTHD1VXjvLCEnZuQ3rJDE9L");
+    BOOST_REQUIRE_EQUAL(encoded[4], encode_base58(data[4]));
+
+    data_stack decoded;
+    BOOST_REQUIRE(decode_base58(decoded, encoded));
+    BOOST_REQUIRE(decoded == data);
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__batch_invalid_character__false_unchanged)
+{
+    data_stack decoded{ { 42 } };
+    BOOST_REQUIRE(!decode_base58(decoded, string_list{ "2g", "a0" }));
+    BOOST_REQUIRE(decoded == data_stack{ { 42 } });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
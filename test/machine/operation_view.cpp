@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+using namespace bc::system::machine;
+
+BOOST_AUTO_TEST_SUITE(operation_view_tests)
+
+// Test helper.
+static bool decodes_as_operations(const std::string& hex)
+{
+    data_chunk bytes;
+    BOOST_REQUIRE(decode_base16(bytes, hex));
+    const chain::script script(bytes, false);
+    const auto& ops = script.operations();
+    const auto views = operation_view::decode(script.encoded());
+
+    if (views.size() != ops.size())
+        return false;
+
+    for (size_t index = 0; index < ops.size(); ++index)
+    {
+        const auto& view = views[index];
+        const auto& op = ops[index];
+
+        if (view.code() != op.code() || view.is_valid() != op.is_valid() ||
+            to_chunk(view.data()) != op.data() || view.to_operation() != op)
+            return false;
+    }
+
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(operation_view__constructor__default__invalid)
+{
+    const operation_view instance;
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.data().empty());
+    BOOST_REQUIRE(instance.code() == opcode::disabled_xor);
+    BOOST_REQUIRE(instance.to_operation() == operation{});
+}
+
+BOOST_AUTO_TEST_CASE(operation_view__constructor__operation__references_data)
+{
+    const operation op(to_chunk(base16_literal("00ff11ee22bb33aa44")));
+    const operation_view instance(op);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.code() == opcode::push_size_9);
+    BOOST_REQUIRE(instance.data().data() == op.data().data());
+    BOOST_REQUIRE(instance.to_operation() == op);
+}
+
+BOOST_AUTO_TEST_CASE(operation_view__decode__empty__empty)
+{
+    BOOST_REQUIRE(operation_view::decode(data_chunk{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(operation_view__decode__pay_key_hash__same_as_operations)
+{
+    BOOST_REQUIRE(decodes_as_operations(
+        "76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac"));
+}
+
+BOOST_AUTO_TEST_CASE(operation_view__decode__sized_pushes__same_as_operations)
+{
+    BOOST_REQUIRE(decodes_as_operations("4c0100" "4d0200aabb" "4e03000000ccddee"
+        "00" "51"));
+}
+
+BOOST_AUTO_TEST_CASE(operation_view__decode__truncated_push__trailing_invalid)
+{
+    BOOST_REQUIRE(decodes_as_operations("5103aabb"));
+    BOOST_REQUIRE(decodes_as_operations("514d01"));
+    BOOST_REQUIRE(decodes_as_operations("4c"));
+
+    const auto script = to_chunk(base16_literal("5103aabb"));
+    const auto views = operation_view::decode(script);
+    BOOST_REQUIRE_EQUAL(views.size(), 2u);
+    BOOST_REQUIRE(views.front().is_valid());
+    BOOST_REQUIRE(!views.back().is_valid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <type_traits>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+using namespace bc::system::machine;
+
+BOOST_AUTO_TEST_SUITE(stack_element_tests)
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor__default__empty_inline)
+{
+    const stack_element instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.is_inline());
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor__small__inline)
+{
+    const auto data = to_chunk(base16_literal("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"));
+    const stack_element instance(data);
+    BOOST_REQUIRE(instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), data.size());
+    BOOST_REQUIRE(to_chunk(instance) == data);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor__large__allocated)
+{
+    const data_chunk data(stack_element::inline_capacity + 1, 0x42);
+    const stack_element instance(data);
+    BOOST_REQUIRE(!instance.is_inline());
+    BOOST_REQUIRE_EQUAL(instance.size(), data.size());
+    BOOST_REQUIRE(to_chunk(instance) == data);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor__initializer_list__expected)
+{
+    const stack_element instance{ 0x01, 0x02 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0x01);
+    BOOST_REQUIRE_EQUAL(instance.back(), 0x02);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__constructor__byte_array__expected)
+{
+    const auto hash = sha256_hash(data_chunk{ 0x2a });
+    const stack_element instance(hash);
+    BOOST_REQUIRE(instance.is_inline());
+    BOOST_REQUIRE(std::equal(hash.begin(), hash.end(), instance.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__move__large__takes_allocation)
+{
+    stack_element instance(data_chunk(200, 0x42));
+    const auto data = instance.data();
+    const stack_element moved(std::move(instance));
+    BOOST_REQUIRE(moved.data() == data);
+    BOOST_REQUIRE_EQUAL(moved.size(), 200u);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.is_inline());
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__move__noexcept__true)
+{
+    // Vector growth moves rather than copies elements only if noexcept.
+    BOOST_REQUIRE(std::is_nothrow_move_constructible<stack_element>::value);
+    BOOST_REQUIRE(std::is_nothrow_move_assignable<stack_element>::value);
+}
+
+BOOST_AUTO_TEST_CASE(stack_element__assign__large_then_small__equal)
+{
+    const stack_element small{ 0x01 };
+    const stack_element large(data_chunk(200, 0x42));
+    stack_element instance;
+    instance = large;
+    BOOST_REQUIRE(instance == large);
+    instance = small;
+    BOOST_REQUIRE(instance == small);
+    BOOST_REQUIRE(instance != large);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
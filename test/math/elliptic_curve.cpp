@@ -131,6 +131,75 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__negative__test)
     BOOST_REQUIRE(!verify_signature(point, sighash, signature));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__empty__empty)
+{
+    BOOST_REQUIRE(verify_signatures({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__mixed__expected)
+{
+    ec_signature signature;
+    static const auto strict = false;
+    const hash_digest sighash = hash_literal(SIGHASH2);
+    der_signature distinguished;
+    BOOST_REQUIRE(decode_base16(distinguished, SIGNATURE2));
+    BOOST_REQUIRE(parse_signature(signature, distinguished, strict));
+
+    auto invalid = signature;
+    invalid[10] = 110;
+
+    data_chunk point;
+    BOOST_REQUIRE(decode_base16(point, COMPRESSED2));
+    const data_chunk bogus{ 0x02, 0x42 };
+
+    // The valid point is repeated, so that it is parsed once for three items.
+    const signature_verification::list batch
+    {
+        { point, sighash, signature },
+        { point, sighash, invalid },
+        { bogus, sighash, signature },
+        { point, sighash, signature }
+    };
+
+    const auto results = verify_signatures(batch);
+    BOOST_REQUIRE_EQUAL(results.size(), 4u);
+    BOOST_REQUIRE(results[0]);
+    BOOST_REQUIRE(!results[1]);
+    BOOST_REQUIRE(!results[2]);
+    BOOST_REQUIRE(results[3]);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__pool__matches_single)
+{
+    ec_compressed point;
+    const ec_secret secret = hash_literal(SECRET1);
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    signature_verification::list batch;
+
+    for (uint8_t index = 0; index < 16; ++index)
+    {
+        ec_signature signature;
+        const auto hash = bitcoin_hash(data_chunk{ index });
+        BOOST_REQUIRE(sign(signature, secret, hash));
+
+        // Every third signature is of the wrong hash.
+        const auto signed_hash = index % 3 == 0 ? null_hash : hash;
+        batch.push_back({ to_chunk(point), signed_hash, signature });
+    }
+
+    threadpool pool(4);
+    const auto results = verify_signatures(batch, pool);
+    pool.shutdown();
+    pool.join();
+
+    BOOST_REQUIRE(results == verify_signatures(batch));
+    BOOST_REQUIRE_EQUAL(results.size(), batch.size());
+
+    for (size_t index = 0; index < results.size(); ++index)
+        BOOST_REQUIRE_EQUAL(results[index], index % 3 != 0);
+}
+
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__positive__test)
 {
     ec_secret secret1{ { 1, 2, 3 } };
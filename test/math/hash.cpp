@@ -58,6 +58,153 @@ BOOST_AUTO_TEST_CASE(sha256_hash_test)
     BOOST_REQUIRE_EQUAL(encode_base16(hash), "3a6eb0790f39ac87c94f3856b2dd2c5d110e6811602261a9a923d3bb23adc8b7");
 }
 
+BOOST_AUTO_TEST_CASE(sha256_hash__vectors__expected)
+{
+    for (const auto& result: sha256_tests)
+    {
+        data_chunk data;
+        BOOST_REQUIRE(decode_base16(data, result.input));
+        BOOST_REQUIRE_EQUAL(encode_base16(sha256_hash(data)), result.result);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hash__midstate__same_as_whole)
+{
+    data_chunk prefix(2 * 64);
+    for (size_t index = 0; index < prefix.size(); ++index)
+        prefix[index] = static_cast<uint8_t>(index);
+
+    const auto midstate = sha256_midstate(prefix);
+
+    for (size_t length = 0; length < 130; ++length)
+    {
+        const data_chunk data(length, 0x2a);
+        const auto expected = sha256_hash(build_chunk({ prefix, data }));
+        BOOST_REQUIRE(sha256_hash(midstate, 2, data) == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hash__all_backends__same_as_portable)
+{
+    const auto original = get_sha256_backend();
+    BOOST_REQUIRE(sha256_available(sha256_backend::portable));
+
+    // Lengths span partial, single and multiple (odd and even) block counts.
+    data_chunk data(1031);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 7 + 3);
+
+    hash_list expected;
+    BOOST_REQUIRE(set_sha256_backend(sha256_backend::portable));
+    for (size_t length = 0; length <= data.size(); length += 13)
+    {
+        const data_slice slice(data.data(), data.data() + length);
+        expected.push_back(sha256_hash(slice));
+        expected.push_back(bitcoin_hash(slice));
+        expected.push_back(sha256_hash(slice, data));
+        expected.push_back(hmac_sha256_hash(slice, data));
+    }
+
+    for (const auto backend: { sha256_backend::sse41, sha256_backend::avx2,
+        sha256_backend::shani })
+    {
+        if (!set_sha256_backend(backend))
+        {
+            BOOST_REQUIRE(!sha256_available(backend));
+            continue;
+        }
+
+        BOOST_REQUIRE(get_sha256_backend() == backend);
+
+        for (const auto& result: sha256_tests)
+        {
+            data_chunk vector;
+            BOOST_REQUIRE(decode_base16(vector, result.input));
+            BOOST_REQUIRE_EQUAL(encode_base16(sha256_hash(vector)), result.result);
+        }
+
+        auto it = expected.begin();
+        for (size_t length = 0; length <= data.size(); length += 13)
+        {
+            const data_slice slice(data.data(), data.data() + length);
+            BOOST_REQUIRE(sha256_hash(slice) == *it++);
+            BOOST_REQUIRE(bitcoin_hash(slice) == *it++);
+            BOOST_REQUIRE(sha256_hash(slice, data) == *it++);
+            BOOST_REQUIRE(hmac_sha256_hash(slice, data) == *it++);
+        }
+    }
+
+    BOOST_REQUIRE(set_sha256_backend(original));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoin_hash_batch__all_backends__same_as_bitcoin_hash)
+{
+    const auto original = get_sha256_backend();
+
+    // Message lengths vary across lanes and padding block boundaries.
+    data_stack messages;
+    for (size_t length = 0; length < 300; length += 7)
+    {
+        data_chunk message(length);
+        for (size_t index = 0; index < length; ++index)
+            message[index] = static_cast<uint8_t>(index ^ length);
+
+        messages.push_back(message);
+    }
+
+    const std::vector<data_slice> slices(messages.begin(), messages.end());
+
+    for (const auto backend: { sha256_backend::portable,
+        sha256_backend::sse41, sha256_backend::avx2, sha256_backend::shani })
+    {
+        if (!set_sha256_backend(backend))
+            continue;
+
+        BOOST_REQUIRE(bitcoin_hash_batch({}).empty());
+
+        // Fewer messages than lanes is also covered by the leading subset.
+        for (const auto count: { size_t(1), size_t(3), slices.size() })
+        {
+            const std::vector<data_slice> subset(slices.begin(),
+                slices.begin() + count);
+            const auto hashes = bitcoin_hash_batch(subset);
+            BOOST_REQUIRE_EQUAL(hashes.size(), count);
+
+            for (size_t index = 0; index < count; ++index)
+                BOOST_REQUIRE(hashes[index] == bitcoin_hash(subset[index]));
+        }
+    }
+
+    BOOST_REQUIRE(set_sha256_backend(original));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoin_hash_pairs__all_backends__same_as_bitcoin_hash)
+{
+    const auto original = get_sha256_backend();
+
+    hash_list hashes;
+    for (size_t index = 0; index < 30; ++index)
+        hashes.push_back(sha256_hash(to_chunk(to_little_endian(index))));
+
+    for (const auto backend: { sha256_backend::portable,
+        sha256_backend::sse41, sha256_backend::avx2, sha256_backend::shani })
+    {
+        if (!set_sha256_backend(backend))
+            continue;
+
+        BOOST_REQUIRE(bitcoin_hash_pairs({}).empty());
+
+        const auto parents = bitcoin_hash_pairs(hashes);
+        BOOST_REQUIRE_EQUAL(parents.size(), hashes.size() / 2);
+
+        for (size_t index = 0; index < parents.size(); ++index)
+            BOOST_REQUIRE(parents[index] == bitcoin_hash(build_chunk(
+                { hashes[2 * index], hashes[2 * index + 1] })));
+    }
+
+    BOOST_REQUIRE(set_sha256_backend(original));
+}
+
 BOOST_AUTO_TEST_CASE(sha512_hash_test)
 {
     const data_chunk chunk{ 'd', 'a', 't', 'a' };
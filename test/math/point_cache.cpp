@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(point_cache_tests)
+
+static const auto compressed = to_chunk(base16_literal(
+    "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"));
+static const point_cache::parsed_point parsed{ { 0x2a } };
+
+BOOST_AUTO_TEST_CASE(point_cache__find__empty__false_miss)
+{
+    const point_cache instance(1024);
+    point_cache::parsed_point out;
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 1024u);
+    BOOST_REQUIRE(!instance.find(out, compressed));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(point_cache__find__inserted__true_hit_expected)
+{
+    point_cache instance(1024);
+    point_cache::parsed_point out;
+    instance.insert(compressed, parsed);
+    BOOST_REQUIRE(instance.find(out, compressed));
+    BOOST_REQUIRE(out == parsed);
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(point_cache__find__different_point__false)
+{
+    point_cache instance(1024);
+    point_cache::parsed_point out;
+    instance.insert(compressed, parsed);
+
+    // Same slot (x-coordinate prefix), different sign and tail.
+    auto other = compressed;
+    other.front() = 0x03;
+    BOOST_REQUIRE(!instance.find(out, other));
+    other = compressed;
+    other.back() ^= 0x01;
+    BOOST_REQUIRE(!instance.find(out, other));
+}
+
+BOOST_AUTO_TEST_CASE(point_cache__insert__invalid_size__not_cached)
+{
+    point_cache instance(1024);
+    point_cache::parsed_point out;
+    const data_chunk point(compressed.begin(), compressed.end() - 1);
+    instance.insert(point, parsed);
+    BOOST_REQUIRE(!instance.find(out, point));
+}
+
+BOOST_AUTO_TEST_CASE(point_cache__clear__inserted__false)
+{
+    point_cache instance(1024);
+    point_cache::parsed_point out;
+    instance.insert(compressed, parsed);
+    instance.clear();
+    BOOST_REQUIRE(!instance.find(out, compressed));
+}
+
+BOOST_AUTO_TEST_CASE(point_cache__resize__zero__disabled)
+{
+    point_cache instance(1024);
+    point_cache::parsed_point out;
+    instance.resize(0);
+    instance.insert(compressed, parsed);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE(!instance.find(out, compressed));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(signature_cache_tests)
+
+static const auto sighash = hash_literal(
+    "8a6d9302fbe24f0ec756a94ecfc837eaffe16c43d1e68c62dfe980d99eea556f");
+static const auto public_key = to_chunk(base16_literal(
+    "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"));
+static const ec_signature signature{ { 0x2a } };
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__empty__false_miss)
+{
+    const signature_cache instance(1024);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 1024u);
+    BOOST_REQUIRE(!instance.contains(sighash, public_key, signature));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__inserted__true_hit)
+{
+    signature_cache instance(1024);
+    instance.insert(sighash, public_key, signature);
+    BOOST_REQUIRE(instance.contains(sighash, public_key, signature));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__different_key__false)
+{
+    signature_cache instance(1024);
+    instance.insert(sighash, public_key, signature);
+    auto other = public_key;
+    other.back() ^= 0x01;
+    BOOST_REQUIRE(!instance.contains(sighash, other, signature));
+    BOOST_REQUIRE(!instance.contains(null_hash, public_key, signature));
+    BOOST_REQUIRE(!instance.contains(sighash, public_key, ec_signature{}));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__clear__inserted__false)
+{
+    signature_cache instance(1024);
+    instance.insert(sighash, public_key, signature);
+    instance.clear();
+    BOOST_REQUIRE(!instance.contains(sighash, public_key, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__resize__zero__disabled)
+{
+    signature_cache instance(1024);
+    instance.resize(0);
+    instance.insert(sighash, public_key, signature);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE(!instance.contains(sighash, public_key, signature));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(siphash_tests)
+
+// Reference vectors use key 000102..0f and message 000102.. of each size.
+static const siphash_key reference_key
+{
+    {
+        0x0706050403020100,
+        0x0f0e0d0c0b0a0908
+    }
+};
+
+static data_chunk reference_message(size_t size)
+{
+    data_chunk out(size);
+
+    for (size_t index = 0; index < size; ++index)
+        out[index] = static_cast<uint8_t>(index);
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(siphash__to_siphash_key__sequence__little_endian_words)
+{
+    half_hash key;
+    const auto message = reference_message(half_hash_size);
+    std::copy(message.begin(), message.end(), key.begin());
+    BOOST_REQUIRE(to_siphash_key(key) == reference_key);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__empty__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(reference_key, reference_message(0)), 0x726fdb47dd0e0e31u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__one_byte__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(reference_key, reference_message(1)), 0x74f839c593dc67fdu);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__one_word__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(reference_key, reference_message(8)), 0x93f5f5799a932462u);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__two_words__expected)
+{
+    BOOST_REQUIRE_EQUAL(siphash(reference_key, reference_message(16)), 0x3f2acc7f57c29bdbu);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__hash_digest__expected)
+{
+    hash_digest hash;
+    const auto message = reference_message(hash_size);
+    std::copy(message.begin(), message.end(), hash.begin());
+    BOOST_REQUIRE_EQUAL(siphash(reference_key, hash), 0x7127512f72f27cceu);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__hash_list__matches_individual)
+{
+    // Nine hashes cover two full batches of lanes and a remainder.
+    hash_list hashes;
+
+    for (uint8_t index = 0; index < 9u; ++index)
+        hashes.push_back(sha256_hash(data_chunk{ index }));
+
+    const auto values = siphash(reference_key, hashes);
+    BOOST_REQUIRE_EQUAL(values.size(), hashes.size());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE_EQUAL(values[index], siphash(reference_key, hashes[index]));
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphash__empty_hash_list__empty)
+{
+    BOOST_REQUIRE(siphash(reference_key, hash_list{}).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
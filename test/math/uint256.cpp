@@ -20,6 +20,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 #include <bitcoin/system.hpp>
 
 using namespace bc::system;
@@ -774,4 +775,155 @@ BOOST_AUTO_TEST_CASE(uint256__assign_divide__max_hash_by_256__shifts_right_8_bit
     BOOST_REQUIRE_EQUAL(quotient, uint256_t("0x00ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"));
 }
 
+// uint256 (fixed width)
+//-----------------------------------------------------------------------------
+
+static uint256_t to_big(const uint256& value)
+{
+    return static_cast<uint256_t>(value);
+}
+
+// Deterministic values spanning all word lengths, for comparison.
+static std::vector<uint256_t> samples()
+{
+    std::vector<uint256_t> out
+    {
+        0, 1, 3, 256, max_hash, negative_zero_hash, most_hash, odd_hash,
+        half_hash, quarter_hash, ones_hash, fives_hash
+    };
+
+    uint64_t seed = 0x9e3779b97f4a7c15;
+
+    for (size_t count = 0; count < 64; ++count)
+    {
+        uint256_t value;
+        const auto words = 1 + count % 4;
+
+        for (size_t word = 0; word < words; ++word)
+        {
+            seed = seed * 6364136223846793005 + 1442695040888963407;
+            value <<= 64;
+            value |= seed;
+        }
+
+        out.push_back(value);
+    }
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_round_trip__samples__unchanged)
+{
+    for (const auto& value: samples())
+        BOOST_REQUIRE_EQUAL(to_big(uint256(value)), value);
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_construct_hash__odd__matches_to_uint256)
+{
+    static const auto hash = hash_literal("8437390223499ab234bf128e8cd092343485898923aaaaabbcbcc4874353fff4");
+    BOOST_REQUIRE_EQUAL(to_big(uint256(hash)), to_uint256(hash));
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_compare__samples__matches_multiprecision)
+{
+    const auto values = samples();
+
+    for (const auto& left: values)
+    {
+        for (const auto& right: values)
+        {
+            const uint256 fixed_left(left);
+            const uint256 fixed_right(right);
+            BOOST_REQUIRE_EQUAL(fixed_left == fixed_right, left == right);
+            BOOST_REQUIRE_EQUAL(fixed_left < fixed_right, left < right);
+            BOOST_REQUIRE_EQUAL(fixed_left >= fixed_right, left >= right);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_shift__samples__matches_multiprecision)
+{
+    static const size_t shifts[] = { 0, 1, 8, 31, 63, 64, 65, 127, 128, 200, 255, 256, 300 };
+
+    for (const auto& value: samples())
+    {
+        for (const auto shift: shifts)
+        {
+            BOOST_REQUIRE_EQUAL(to_big(uint256(value) << shift), uint256_t(value << shift));
+            BOOST_REQUIRE_EQUAL(to_big(uint256(value) >> shift), uint256_t(value >> shift));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_add_subtract__samples__matches_multiprecision)
+{
+    const auto values = samples();
+
+    for (const auto& left: values)
+    {
+        for (const auto& right: values)
+        {
+            BOOST_REQUIRE_EQUAL(to_big(uint256(left) + uint256(right)), uint256_t(left + right));
+            BOOST_REQUIRE_EQUAL(to_big(uint256(left) - uint256(right)), uint256_t(left - right));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_multiply_divide_small__samples__matches_multiprecision)
+{
+    static const uint32_t factors[] = { 1, 3, 7, 256, 600, 1209600, 0xfedcba98, bc::max_uint32 };
+
+    for (const auto& value: samples())
+    {
+        for (const auto factor: factors)
+        {
+            BOOST_REQUIRE_EQUAL(to_big(uint256(value) * factor), uint256_t(value * factor));
+            BOOST_REQUIRE_EQUAL(to_big(uint256(value) / factor), uint256_t(value / factor));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_divide__samples__matches_multiprecision)
+{
+    const auto values = samples();
+
+    for (const auto& left: values)
+        for (const auto& right: values)
+            if (right != 0)
+                BOOST_REQUIRE_EQUAL(to_big(uint256(left) / uint256(right)), uint256_t(left / right));
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_not__samples__matches_multiprecision)
+{
+    for (const auto& value: samples())
+        BOOST_REQUIRE_EQUAL(to_big(~uint256(value)), uint256_t(~value));
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_msb__samples__matches_multiprecision)
+{
+    for (const auto& value: samples())
+        if (value != 0)
+            BOOST_REQUIRE_EQUAL(uint256(value).msb(), boost::multiprecision::msb(value));
+
+    BOOST_REQUIRE_EQUAL(uint256().msb(), 0u);
+    BOOST_REQUIRE_EQUAL(uint256().bytes(), 0u);
+    BOOST_REQUIRE_EQUAL(uint256(256).bytes(), 2u);
+    BOOST_REQUIRE_EQUAL(uint256(max_hash).bytes(), 32u);
+}
+
+BOOST_AUTO_TEST_CASE(uint256__fixed_proof__samples__matches_multiprecision)
+{
+    for (const auto& target: samples())
+    {
+        const uint256 fixed(target);
+        const uint256_t divisor = target + 1;
+
+        if (divisor == 0)
+            continue;
+
+        const uint256_t expected = (~target / divisor) + 1;
+        BOOST_REQUIRE_EQUAL(to_big((~fixed / (fixed + 1)) + 1), expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
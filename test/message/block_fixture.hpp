@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_TEST_BLOCK_FIXTURE_HPP
+#define LIBBITCOIN_SYSTEM_TEST_BLOCK_FIXTURE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system.hpp>
+
+// Transactions are distinguished by locktime, the first is the coinbase.
+inline bc::system::chain::transaction::list make_transactions(size_t count,
+    uint32_t offset=0)
+{
+    using namespace bc::system::chain;
+    transaction::list out;
+
+    for (size_t index = 0; index < count; ++index)
+        out.emplace_back(1u, offset + static_cast<uint32_t>(index),
+            input::list{}, output::list{});
+
+    return out;
+}
+
+// The header commits to the transactions by merkle root.
+inline bc::system::chain::block make_block(
+    const bc::system::chain::transaction::list& transactions)
+{
+    using namespace bc::system::chain;
+    const block unrooted(header{}, transactions);
+    const header rooted(1u, bc::system::null_hash,
+        unrooted.generate_merkle_root(), 0u, 0u, 0u);
+    return block(rooted, transactions);
+}
+
+#endif
@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(bloom_filter_tests)
+
+static data_chunk base16(const std::string& text)
+{
+    data_chunk out;
+    BOOST_REQUIRE(decode_base16(out, text));
+    return out;
+}
+
+static const auto public_key = base16(
+    "03a34b99f22c790c4e36b2b3c2c35a36db06226e41c692fc82b8b56ac1c540c5bd");
+
+static const short_hash key_hash = bitcoin_short_hash(public_key);
+
+// An unrelated spend of a single output with the given script.
+static chain::transaction make_transaction(const chain::script& script,
+    uint32_t locktime=0)
+{
+    const chain::output_point previous(null_hash, 0);
+    const chain::input input(previous, chain::script{}, 0);
+    const chain::output output(1000, script);
+    return { 1u, locktime, { input }, { output } };
+}
+
+static chain::transaction make_spend(const chain::output_point& previous)
+{
+    const chain::input input(previous, chain::script{}, 0);
+    return { 1u, 0u, { input }, chain::output::list{} };
+}
+
+static message::bloom_filter make_filter(uint8_t flags)
+{
+    message::bloom_filter filter(10, 0.000001, 0, flags);
+    filter.insert(key_hash);
+    return filter;
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__constructor_default__always__matches_everything)
+{
+    message::bloom_filter instance;
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.filter().empty());
+    BOOST_REQUIRE(instance.contains(base16("00")));
+    BOOST_REQUIRE(instance.match(make_transaction(chain::script{})));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__constructor_sized__maximum_rate__limited)
+{
+    message::bloom_filter instance(1000000, 0.000001, 0, 0);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.filter().size(), bc::max_filter_load);
+    BOOST_REQUIRE_LE(instance.hash_functions(), bc::max_filter_functions);
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__insert__satoshi_vector__expected_serialization)
+{
+    message::bloom_filter instance(3, 0.01, 0, message::bloom_filter::all);
+    instance.insert(base16("99108ad8ed9bb6274d3980bab5a85c048f0950c8"));
+    BOOST_REQUIRE(instance.contains(base16("99108ad8ed9bb6274d3980bab5a85c048f0950c8")));
+    BOOST_REQUIRE(!instance.contains(base16("19108ad8ed9bb6274d3980bab5a85c048f0950c8")));
+
+    instance.insert(base16("b5a2c786d9ef4658287ced5914b37a1b4aa32eee"));
+    BOOST_REQUIRE(instance.contains(base16("b5a2c786d9ef4658287ced5914b37a1b4aa32eee")));
+
+    instance.insert(base16("b9300670b4c5366e95b2699e8b18bc75e5f729c5"));
+    BOOST_REQUIRE(instance.contains(base16("b9300670b4c5366e95b2699e8b18bc75e5f729c5")));
+
+    const auto load = instance.to_filter_load();
+    BOOST_REQUIRE_EQUAL(encode_base16(load.to_data(message::version::level::bip37)),
+        "03614e9b050000000000000001");
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__insert__satoshi_tweak_vector__expected_serialization)
+{
+    message::bloom_filter instance(3, 0.01, 2147483649u, message::bloom_filter::all);
+    instance.insert(base16("99108ad8ed9bb6274d3980bab5a85c048f0950c8"));
+    instance.insert(base16("b5a2c786d9ef4658287ced5914b37a1b4aa32eee"));
+    instance.insert(base16("b9300670b4c5366e95b2699e8b18bc75e5f729c5"));
+    BOOST_REQUIRE(!instance.contains(base16("19108ad8ed9bb6274d3980bab5a85c048f0950c8")));
+
+    const auto load = instance.to_filter_load();
+    BOOST_REQUIRE_EQUAL(encode_base16(load.to_data(message::version::level::bip37)),
+        "03ce4299050000000100008001");
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__constructor_load__roundtrip__equal)
+{
+    const message::filter_load load(base16("614e9b"), 5, 0, 1);
+    message::bloom_filter instance(load);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.to_filter_load() == load);
+    BOOST_REQUIRE(instance.contains(base16("99108ad8ed9bb6274d3980bab5a85c048f0950c8")));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__is_valid__oversized__false)
+{
+    const message::filter_load load(data_chunk(bc::max_filter_load + 1u), 1, 0, 0);
+    BOOST_REQUIRE(!message::bloom_filter(load).is_valid());
+    const message::filter_load functions(data_chunk(1), 51, 0, 0);
+    BOOST_REQUIRE(!message::bloom_filter(functions).is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__add__oversized__false)
+{
+    message::bloom_filter instance(10, 0.01, 0, 0);
+    BOOST_REQUIRE(!instance.add(message::filter_add(data_chunk(bc::max_filter_add + 1u))));
+    BOOST_REQUIRE(instance.add(message::filter_add(base16("0102"))));
+    BOOST_REQUIRE(instance.contains(base16("0102")));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__contains__inserted_point__true)
+{
+    message::bloom_filter instance(10, 0.000001, 0, 0);
+    const chain::output_point point(hash_literal(
+        "90c122d70786e899529d71dbeba91ba216982fb6ba58f3bdaab65e73b7e9260b"), 1);
+    instance.insert(point);
+    BOOST_REQUIRE(instance.contains(point));
+    BOOST_REQUIRE(instance.contains(point.to_data()));
+    BOOST_REQUIRE(!instance.contains(chain::output_point(point.hash(), 0)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__transaction_hash__true)
+{
+    const auto tx = make_transaction(chain::script{}, 42);
+    message::bloom_filter instance(10, 0.000001, 0, 0);
+    BOOST_REQUIRE(!instance.match(tx));
+    instance.insert(tx.hash());
+    BOOST_REQUIRE(instance.match(tx));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__input_script_push__true)
+{
+    const chain::script script(machine::operation::list{ { public_key } });
+    const chain::input input(chain::output_point(null_hash, 0), script, 0);
+    const chain::transaction tx(1u, 0u, { input }, chain::output::list{});
+
+    message::bloom_filter instance(10, 0.000001, 0, 0);
+    BOOST_REQUIRE(!instance.match(tx));
+    instance.insert(public_key);
+    BOOST_REQUIRE(instance.match(tx));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__output_update_all__spend_matches)
+{
+    const chain::script script(chain::script::to_pay_key_hash_pattern(key_hash));
+    const auto tx = make_transaction(script);
+    const chain::output_point outpoint(tx.hash(), 0);
+
+    auto instance = make_filter(message::bloom_filter::all);
+    BOOST_REQUIRE(instance.match(tx));
+    BOOST_REQUIRE(instance.contains(outpoint));
+    BOOST_REQUIRE(instance.match(make_spend(outpoint)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__output_update_all_high_bits__spend_matches)
+{
+    const chain::script script(chain::script::to_pay_key_hash_pattern(key_hash));
+    const auto tx = make_transaction(script);
+    const chain::output_point outpoint(tx.hash(), 0);
+
+    // Bits above the update mask do not change the update behavior.
+    auto instance = make_filter(0x80 | message::bloom_filter::all);
+    BOOST_REQUIRE(instance.match(tx));
+    BOOST_REQUIRE(instance.contains(outpoint));
+    BOOST_REQUIRE(instance.match(make_spend(outpoint)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__output_update_none__spend_not_matched)
+{
+    const chain::script script(chain::script::to_pay_key_hash_pattern(key_hash));
+    const auto tx = make_transaction(script);
+    const chain::output_point outpoint(tx.hash(), 0);
+
+    auto instance = make_filter(message::bloom_filter::none);
+    BOOST_REQUIRE(instance.match(tx));
+    BOOST_REQUIRE(!instance.match(make_spend(outpoint)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__p2pubkey_only_key_hash__spend_not_matched)
+{
+    const chain::script script(chain::script::to_pay_key_hash_pattern(key_hash));
+    const auto tx = make_transaction(script);
+    const chain::output_point outpoint(tx.hash(), 0);
+
+    auto instance = make_filter(message::bloom_filter::p2pubkey_only);
+    BOOST_REQUIRE(instance.match(tx));
+    BOOST_REQUIRE(!instance.match(make_spend(outpoint)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__p2pubkey_only_public_key__spend_matches)
+{
+    const chain::script script(chain::script::to_pay_public_key_pattern(public_key));
+    const auto tx = make_transaction(script);
+    const chain::output_point outpoint(tx.hash(), 0);
+
+    message::bloom_filter instance(10, 0.000001, 0, message::bloom_filter::p2pubkey_only);
+    instance.insert(public_key);
+    BOOST_REQUIRE(instance.match(tx));
+    BOOST_REQUIRE(instance.match(make_spend(outpoint)));
+}
+
+BOOST_AUTO_TEST_CASE(bloom_filter__match__block__transactions_in_order)
+{
+    const chain::script script(chain::script::to_pay_key_hash_pattern(key_hash));
+    const auto funding = make_transaction(script);
+    const auto spend = make_spend(chain::output_point(funding.hash(), 0));
+    const auto unrelated = make_transaction(chain::script{}, 7);
+    const chain::block block(chain::header{}, { unrelated, funding, spend });
+
+    auto instance = make_filter(message::bloom_filter::all);
+    const auto matches = instance.match(block);
+    BOOST_REQUIRE_EQUAL(matches.size(), 3u);
+    BOOST_REQUIRE(!matches[0]);
+    BOOST_REQUIRE(matches[1]);
+    BOOST_REQUIRE(matches[2]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
  */
 #include <boost/test/unit_test.hpp>
 #include <bitcoin/system.hpp>
+#include "block_fixture.hpp"
 
 using namespace bc::system;
 
@@ -709,5 +710,29 @@ BOOST_AUTO_TEST_CASE(compact_block__operator_boolean_not_equals__differs__return
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(compact_block__constructor_block__always__prefilled_coinbase)
+{
+    const auto block = make_block(make_transactions(5));
+    const message::compact_block compact(block, 42u);
+    BOOST_REQUIRE(compact.is_valid());
+    BOOST_REQUIRE_EQUAL(compact.short_ids().size(), 4u);
+    BOOST_REQUIRE_EQUAL(compact.transactions().size(), 1u);
+    BOOST_REQUIRE_EQUAL(compact.transactions().front().index(), 0u);
+    BOOST_REQUIRE(compact.transactions().front().transaction() == block.transactions().front());
+}
+
+BOOST_AUTO_TEST_CASE(compact_block__to_short_ids__block_hashes__equals_short_ids)
+{
+    const auto block = make_block(make_transactions(3));
+    const message::compact_block compact(block, 42u);
+    const auto ids = message::compact_block::to_short_ids(compact.short_id_key(),
+    {
+        block.transactions()[1].hash(),
+        block.transactions()[2].hash()
+    });
+
+    BOOST_REQUIRE(ids == compact.short_ids());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
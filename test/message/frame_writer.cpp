@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+using namespace bc::system::message;
+
+BOOST_AUTO_TEST_SUITE(frame_writer_tests)
+
+static const uint32_t magic = 0xd9b4bef9;
+
+BOOST_AUTO_TEST_CASE(frame_writer__finish__payload_written__framed)
+{
+    const auto payload = to_chunk(base16_literal("0102030405"));
+    data_chunk buffer;
+    frame_writer sink(buffer, payload.size());
+    sink.write_bytes(payload);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.finish(magic, "foo"));
+
+    const heading expected(magic, "foo", 5u, bitcoin_checksum(payload));
+    BOOST_REQUIRE(buffer == build_chunk({ expected.to_data(), payload }));
+}
+
+BOOST_AUTO_TEST_CASE(frame_writer__finish__payload_short__false)
+{
+    data_chunk buffer;
+    frame_writer sink(buffer, 5u);
+    sink.write_4_bytes_little_endian(42u);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(!sink.finish(magic, "foo"));
+}
+
+BOOST_AUTO_TEST_CASE(frame_writer__write__payload_overflow__invalid)
+{
+    data_chunk buffer;
+    frame_writer sink(buffer, 3u);
+    sink.write_4_bytes_little_endian(42u);
+    BOOST_REQUIRE(!sink);
+    BOOST_REQUIRE(!sink.finish(magic, "foo"));
+}
+
+BOOST_AUTO_TEST_CASE(frame_writer__frame_heading__payload__matches_serialize)
+{
+    const ping instance(42u);
+    const auto payload = instance.to_data(version::level::maximum);
+    const auto message = serialize(version::level::maximum, instance, magic);
+    const auto head = frame_heading(magic, ping::command, payload);
+    BOOST_REQUIRE(std::equal(head.begin(), head.end(), message.begin()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -742,4 +742,114 @@ BOOST_AUTO_TEST_CASE(headers__is_sequential__disordered__false)
     BOOST_REQUIRE(!instance.is_sequential());
 }
 
+static const header mainnet_block1
+{
+    1u,
+    hash_literal("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"),
+    hash_literal("0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098"),
+    1231469665u,
+    0x1d00ffffu,
+    2573394689u
+};
+
+static const header mainnet_block2
+{
+    1u,
+    hash_literal("00000000839a8e6886ab5951d76f411475428afc90947ee320161bbf18eb6048"),
+    hash_literal("9b0fc92260312ce44e74ef369f5c66bbb85848f2eddd5a7a1cde251e54ccfdd5"),
+    1231469744u,
+    0x1d00ffffu,
+    1639830024u
+};
+
+// The state retains a reference to its checkpoints.
+static const config::checkpoint::list no_checkpoints{};
+
+static chain::chain_state genesis_state(const settings& settings)
+{
+    chain::chain_state::data values;
+    values.height = 0;
+    values.hash = mainnet_block1.previous_block_hash();
+    values.bits.self = 0x1d00ffff;
+    values.version.self = 1;
+    values.timestamp.self = 1231006505;
+    values.timestamp.retarget = 1231006505;
+    return{ std::move(values), no_checkpoints, machine::rule_fork::no_rules, 0, settings };
+}
+
+BOOST_AUTO_TEST_CASE(headers__cache_hashes__mainnet__expected)
+{
+    const headers instance({ mainnet_block1, mainnet_block2 });
+    instance.cache_hashes();
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.elements()[0].hash()), "00000000839a8e6886ab5951d76f411475428afc90947ee320161bbf18eb6048");
+    BOOST_REQUIRE_EQUAL(encode_hash(instance.elements()[1].hash()), "000000006a625f06636b8bb6ac7b960a8d03705d1ace08b1a19da3fdcc99ddbd");
+}
+
+BOOST_AUTO_TEST_CASE(headers__check__mainnet__success)
+{
+    const settings settings(config::settings::mainnet);
+    const headers instance({ mainnet_block1, mainnet_block2 });
+    const auto ec = instance.check(settings.timestamp_limit_seconds, settings.proof_of_work_limit);
+    BOOST_REQUIRE_EQUAL(ec, error::success);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check__disordered__invalid_previous_block)
+{
+    const settings settings(config::settings::mainnet);
+    const headers instance({ mainnet_block2, mainnet_block1 });
+    const auto ec = instance.check(settings.timestamp_limit_seconds, settings.proof_of_work_limit);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_previous_block);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check__invalid_nonce__invalid_proof_of_work)
+{
+    const settings settings(config::settings::mainnet);
+    headers instance({ mainnet_block1, mainnet_block2 });
+    instance.elements()[1].set_nonce(42);
+    const auto ec = instance.check(settings.timestamp_limit_seconds, settings.proof_of_work_limit);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check__threadpool_mainnet__success)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    const headers instance({ mainnet_block1, mainnet_block2 });
+    const auto ec = instance.check(settings.timestamp_limit_seconds, settings.proof_of_work_limit, pool);
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(ec, error::success);
+}
+
+BOOST_AUTO_TEST_CASE(headers__check__threadpool_invalid_nonce__invalid_proof_of_work)
+{
+    threadpool pool(4);
+    const settings settings(config::settings::mainnet);
+    headers instance({ mainnet_block1, mainnet_block2 });
+    instance.elements()[0].set_nonce(42);
+    const auto ec = instance.check(settings.timestamp_limit_seconds, settings.proof_of_work_limit, pool);
+    pool.shutdown();
+    pool.join();
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_CASE(headers__accept__genesis_parent__success_populates_state)
+{
+    const settings settings(config::settings::mainnet);
+    const auto parent = genesis_state(settings);
+    const headers instance({ mainnet_block1, mainnet_block2 });
+    BOOST_REQUIRE_EQUAL(instance.accept(parent, settings), error::success);
+    BOOST_REQUIRE(instance.elements()[1].metadata.state);
+    BOOST_REQUIRE_EQUAL(instance.elements()[1].metadata.state->height(), 2u);
+    BOOST_REQUIRE(instance.elements()[1].metadata.state->hash() == instance.elements()[1].hash());
+}
+
+BOOST_AUTO_TEST_CASE(headers__accept__unlinked_parent__invalid_previous_block)
+{
+    const settings settings(config::settings::mainnet);
+    const auto parent = genesis_state(settings);
+    const headers instance({ mainnet_block2 });
+    BOOST_REQUIRE_EQUAL(instance.accept(parent, settings), error::invalid_previous_block);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -341,6 +341,39 @@ BOOST_AUTO_TEST_CASE(heading__type__all_cases__match_expected)
     BOOST_REQUIRE(message::message_type::version == instance.type());
 }
 
+BOOST_AUTO_TEST_CASE(heading__type__near_commands__unknown)
+{
+    message::heading instance;
+    instance.set_command("versio");
+    BOOST_REQUIRE(message::message_type::unknown == instance.type());
+    instance.set_command("versionx");
+    BOOST_REQUIRE(message::message_type::unknown == instance.type());
+    instance.set_command("getblocktxm");
+    BOOST_REQUIRE(message::message_type::unknown == instance.type());
+    instance.set_command("TX");
+    BOOST_REQUIRE(message::message_type::unknown == instance.type());
+}
+
+BOOST_AUTO_TEST_CASE(heading__set_command__oversized__truncated)
+{
+    message::heading instance;
+    instance.set_command("sendheadersxyz");
+    BOOST_REQUIRE_EQUAL(instance.command(), "sendheadersx");
+    BOOST_REQUIRE(message::message_type::unknown == instance.type());
+}
+
+BOOST_AUTO_TEST_CASE(heading__from_data__bytes_after_null__ignored)
+{
+    const auto data = to_chunk(base16_literal(
+        "f9beb4d9" "7478006a756e6b0000000000" "00000000" "5df6e0e2"));
+
+    const auto instance = message::heading::factory(data);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.command(), message::transaction::command);
+    BOOST_REQUIRE(message::message_type::transaction == instance.type());
+    BOOST_REQUIRE(instance == message::heading(0xd9b4bef9, "tx", 0u, 0xe2e0f65d));
+}
+
 BOOST_AUTO_TEST_CASE(heading__maximum_size__always__matches_satoshi_fixed_size)
 {
     BOOST_REQUIRE_EQUAL(heading::satoshi_fixed_size(), heading::maximum_size());
@@ -18,6 +18,7 @@
  */
 #include <boost/test/unit_test.hpp>
 #include <bitcoin/system.hpp>
+#include "block_fixture.hpp"
 
 using namespace bc::system;
 
@@ -625,4 +626,124 @@ BOOST_AUTO_TEST_CASE(merkle_block__operator_boolean_not_equals__differs__returns
     BOOST_REQUIRE(instance != expected);
 }
 
+BOOST_AUTO_TEST_CASE(merkle_block__constructor_matches__single_match__root_and_flag)
+{
+    const auto block = make_block(make_transactions(1));
+    const message::merkle_block instance(block, { true });
+    BOOST_REQUIRE_EQUAL(instance.total_transactions(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.hashes().size(), 1u);
+    BOOST_REQUIRE(instance.hashes().front() == block.header().merkle_root());
+    BOOST_REQUIRE(instance.flags() == data_chunk{ 0x01 });
+
+    hash_list hashes;
+    std::vector<size_t> indexes;
+    BOOST_REQUIRE(instance.extract_matches(hashes, indexes));
+    BOOST_REQUIRE(hashes == block.to_hashes());
+    BOOST_REQUIRE(indexes == std::vector<size_t>{ 0 });
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__constructor_matches__no_match__root_only)
+{
+    const auto block = make_block(make_transactions(7));
+    const message::merkle_block instance(block, std::vector<bool>(7, false));
+    BOOST_REQUIRE_EQUAL(instance.hashes().size(), 1u);
+    BOOST_REQUIRE(instance.hashes().front() == block.header().merkle_root());
+    BOOST_REQUIRE(instance.flags() == data_chunk{ 0x00 });
+
+    hash_list hashes;
+    std::vector<size_t> indexes;
+    BOOST_REQUIRE(instance.extract_matches(hashes, indexes));
+    BOOST_REQUIRE(hashes.empty());
+    BOOST_REQUIRE(indexes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__extract_matches__sizes_and_patterns__roundtrip)
+{
+    for (size_t count = 1; count <= 33; ++count)
+    {
+        const auto block = make_block(make_transactions(count));
+        const auto txids = block.to_hashes();
+
+        for (size_t stride = 1; stride <= 5; ++stride)
+        {
+            std::vector<bool> matches(count);
+            hash_list expected_hashes;
+            std::vector<size_t> expected_indexes;
+
+            for (size_t index = 0; index < count; ++index)
+            {
+                matches[index] = (index % stride == stride - 1u);
+
+                if (matches[index])
+                {
+                    expected_hashes.push_back(txids[index]);
+                    expected_indexes.push_back(index);
+                }
+            }
+
+            const message::merkle_block built(block, matches);
+            const auto instance = message::merkle_block::factory(
+                message::version::level::maximum,
+                built.to_data(message::version::level::maximum));
+
+            hash_list hashes;
+            std::vector<size_t> indexes;
+            BOOST_REQUIRE(instance.extract_matches(hashes, indexes));
+            BOOST_REQUIRE(hashes == expected_hashes);
+            BOOST_REQUIRE(indexes == expected_indexes);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__extract_matches__extra_flag_byte__false)
+{
+    const auto block = make_block(make_transactions(5));
+    message::merkle_block instance(block, { false, true, false, false, true });
+    instance.flags().push_back(0x00);
+
+    hash_list hashes;
+    std::vector<size_t> indexes;
+    BOOST_REQUIRE(!instance.extract_matches(hashes, indexes));
+    BOOST_REQUIRE(hashes.empty());
+    BOOST_REQUIRE(indexes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__extract_matches__extra_hash__false)
+{
+    const auto block = make_block(make_transactions(5));
+    message::merkle_block instance(block, { false, true, false, false, true });
+    instance.hashes().push_back(null_hash);
+
+    hash_list hashes;
+    std::vector<size_t> indexes;
+    BOOST_REQUIRE(!instance.extract_matches(hashes, indexes));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__extract_matches__other_header__false)
+{
+    const auto block = make_block(make_transactions(5));
+    message::merkle_block instance(block, { false, true, false, false, true });
+    instance.set_header(chain::header{});
+
+    hash_list hashes;
+    std::vector<size_t> indexes;
+    BOOST_REQUIRE(!instance.extract_matches(hashes, indexes));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_block__extract_matches__duplicated_subtree__false)
+{
+    // The tree of [a, b, c, c] has the root of the tree of [a, b, c].
+    auto transactions = make_transactions(3);
+    transactions.push_back(transactions.back());
+    const auto block = make_block(transactions);
+    BOOST_REQUIRE(block.header().merkle_root() ==
+        make_block(make_transactions(3)).header().merkle_root());
+
+    const message::merkle_block instance(block, { false, false, false, true });
+
+    hash_list hashes;
+    std::vector<size_t> indexes;
+    BOOST_REQUIRE(!instance.extract_matches(hashes, indexes));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -48,4 +48,33 @@ BOOST_AUTO_TEST_CASE(messages__variable_uint_size__eight_byte__expected)
     BOOST_REQUIRE_EQUAL(variable_uint_size(value), 9u);
 }
 
+BOOST_AUTO_TEST_CASE(messages__serialize__verack_mainnet__expected)
+{
+    const auto expected = to_chunk(base16_literal(
+        "f9beb4d9" "76657261636b000000000000" "00000000" "5df6e0e2"));
+
+    BOOST_REQUIRE(serialize(version::level::maximum, verack(), 0xd9b4bef9) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(messages__serialize__ping__heading_and_payload)
+{
+    const ping instance(42u);
+    const auto payload = instance.to_data(version::level::maximum);
+    const heading head(0xd9b4bef9, ping::command,
+        static_cast<uint32_t>(payload.size()), bitcoin_checksum(payload));
+
+    const auto expected = build_chunk({ head.to_data(), payload });
+    BOOST_REQUIRE(serialize(version::level::maximum, instance, 0xd9b4bef9) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(messages__serialize__pooled_buffer__resized_capacity_retained)
+{
+    data_chunk buffer(1000, 0xff);
+    const auto capacity = buffer.capacity();
+    serialize(buffer, version::level::maximum, ping(42u), 0xd9b4bef9);
+    BOOST_REQUIRE_EQUAL(buffer.size(), heading::satoshi_fixed_size() + sizeof(uint64_t));
+    BOOST_REQUIRE_EQUAL(buffer.capacity(), capacity);
+    BOOST_REQUIRE(buffer == serialize(version::level::maximum, ping(42u), 0xd9b4bef9));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
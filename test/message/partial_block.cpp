@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+#include "block_fixture.hpp"
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(partial_block_tests)
+
+static const uint64_t nonce = 42;
+
+BOOST_AUTO_TEST_CASE(partial_block__fill__all_candidates__reconstructed)
+{
+    const auto transactions = make_transactions(6);
+    const auto block = make_block(transactions);
+    message::partial_block instance(message::compact_block(block, nonce));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_complete());
+
+    // The pool is unordered and includes unrelated transactions.
+    auto pool = make_transactions(3, 100);
+    pool.insert(pool.end(), transactions.rbegin(), transactions.rend() - 1);
+    instance.fill(pool);
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE(instance.missing().indexes().empty());
+
+    chain::block out;
+    BOOST_REQUIRE(instance.to_block(out));
+    BOOST_REQUIRE(out.hash() == block.hash());
+    BOOST_REQUIRE(out.transactions() == transactions);
+}
+
+BOOST_AUTO_TEST_CASE(partial_block__fill__partial_pool__missing_differential)
+{
+    const auto transactions = make_transactions(6);
+    const auto block = make_block(transactions);
+    message::partial_block instance(message::compact_block(block, nonce));
+    instance.fill({ transactions[1], transactions[3], transactions[5] });
+    BOOST_REQUIRE(!instance.is_complete());
+
+    chain::block out;
+    BOOST_REQUIRE(!instance.to_block(out));
+
+    const auto request = instance.missing();
+    BOOST_REQUIRE(request.block_hash() == block.hash());
+    BOOST_REQUIRE(request.indexes() == std::vector<uint64_t>({ 2u, 1u }));
+
+    const message::block_transactions response(block.hash(),
+        { transactions[2], transactions[4] });
+    BOOST_REQUIRE(instance.fill(response));
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE(instance.to_block(out));
+    BOOST_REQUIRE(out.transactions() == transactions);
+}
+
+BOOST_AUTO_TEST_CASE(partial_block__fill__response_wrong_count__false)
+{
+    const auto transactions = make_transactions(4);
+    const auto block = make_block(transactions);
+    message::partial_block instance(message::compact_block(block, nonce));
+    const message::block_transactions response(block.hash(),
+        { transactions[1] });
+    BOOST_REQUIRE(!instance.fill(response));
+    BOOST_REQUIRE(!instance.is_complete());
+}
+
+BOOST_AUTO_TEST_CASE(partial_block__fill__response_other_block__false)
+{
+    const auto transactions = make_transactions(2);
+    const auto block = make_block(transactions);
+    message::partial_block instance(message::compact_block(block, nonce));
+    const message::block_transactions response(null_hash, { transactions[1] });
+    BOOST_REQUIRE(!instance.fill(response));
+}
+
+BOOST_AUTO_TEST_CASE(partial_block__to_block__wrong_transaction__merkle_mismatch)
+{
+    const auto transactions = make_transactions(3);
+    const auto block = make_block(transactions);
+    message::partial_block instance(message::compact_block(block, nonce));
+    instance.fill({ transactions[1] });
+
+    const message::block_transactions response(block.hash(),
+        make_transactions(1, 100));
+    BOOST_REQUIRE(instance.fill(response));
+    BOOST_REQUIRE(instance.is_complete());
+
+    chain::block out;
+    BOOST_REQUIRE(!instance.to_block(out));
+}
+
+BOOST_AUTO_TEST_CASE(partial_block__construct__duplicate_short_ids__invalid)
+{
+    const auto block = make_block(make_transactions(1));
+    const message::compact_block compact(block.header(), nonce,
+        { null_mini_hash, null_mini_hash }, {});
+    BOOST_REQUIRE(!message::partial_block(compact).is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(partial_block__construct__prefilled_index_overflow__invalid)
+{
+    const auto transactions = make_transactions(2);
+    const auto block = make_block(transactions);
+    const message::compact_block compact(block.header(), nonce,
+        { null_mini_hash },
+        {
+            { 0u, transactions[0] },
+            { 2u, transactions[1] }
+        });
+
+    BOOST_REQUIRE(!message::partial_block(compact).is_valid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(byte_reader_tests)
+
+BOOST_AUTO_TEST_CASE(byte_reader__is_exhausted__empty__true)
+{
+    const data_chunk data;
+    byte_reader source(data);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE((bool)source);
+    BOOST_REQUIRE_EQUAL(source.remaining(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__peek_byte__nonempty__does_not_advance)
+{
+    const data_chunk data{ 0x42, 0x00 };
+    byte_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.peek_byte(), 0x42u);
+    BOOST_REQUIRE_EQUAL(source.peek_byte(), 0x42u);
+    BOOST_REQUIRE_EQUAL(source.remaining(), 2u);
+    BOOST_REQUIRE((bool)source);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read__serialized__expected)
+{
+    data_chunk data(1 + 2 + 4 + 8 + 4 + 3 + 4 + 6 + hash_size);
+    auto sink = make_unsafe_serializer(data.begin());
+    sink.write_byte(0x80);
+    sink.write_2_bytes_little_endian(0x8040);
+    sink.write_4_bytes_little_endian(0x80402010);
+    sink.write_8_bytes_little_endian(0x8040201011223344);
+    sink.write_4_bytes_big_endian(0x80402010);
+    sink.write_variable_little_endian(1234);
+    sink.write_bytes(to_chunk(to_little_endian<uint32_t>(0xbadf00d)));
+    sink.write_string("hello");
+    sink.write_hash(null_hash);
+
+    byte_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x80u);
+    BOOST_REQUIRE_EQUAL(source.read_2_bytes_little_endian(), 0x8040u);
+    BOOST_REQUIRE_EQUAL(source.read_4_bytes_little_endian(), 0x80402010u);
+    BOOST_REQUIRE_EQUAL(source.read_8_bytes_little_endian(), 0x8040201011223344u);
+    BOOST_REQUIRE_EQUAL(source.read_4_bytes_big_endian(), 0x80402010u);
+    BOOST_REQUIRE_EQUAL(source.read_variable_little_endian(), 1234u);
+    BOOST_REQUIRE_EQUAL(from_little_endian_unsafe<uint32_t>(source.read_bytes(4).begin()), 0xbadf00du);
+    BOOST_REQUIRE_EQUAL(source.read_string(), "hello");
+    BOOST_REQUIRE(source.read_hash() == null_hash);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE((bool)source);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_string__embedded_null__trimmed_and_consumed)
+{
+    const data_chunk data{ 'a', 'b', 0x00, 'c', 0x42 };
+    byte_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_string(4), "ab");
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x42u);
+    BOOST_REQUIRE((bool)source);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_bytes__insufficient__invalid_and_latched)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    byte_reader source(data);
+    BOOST_REQUIRE(source.read_bytes(4).empty());
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE(source.is_exhausted());
+
+    // All subsequent reads return zero, even if the bytes are present.
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0u);
+    BOOST_REQUIRE_EQUAL(source.read_2_bytes_little_endian(), 0u);
+    BOOST_REQUIRE(source.read_hash() == null_hash);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__read_bytes__oversized_size__invalid_without_allocation)
+{
+    // A size prefix of 2^64-1 cannot be satisfied by the buffer.
+    const data_chunk data{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f };
+    byte_reader source(data);
+    BOOST_REQUIRE(source.read_bytes(static_cast<size_t>(source.read_variable_little_endian())).empty());
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__skip__past_end__invalid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    byte_reader source(data);
+    source.skip(2);
+    BOOST_REQUIRE((bool)source);
+    BOOST_REQUIRE(source.is_exhausted());
+    source.skip(1);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__transaction_from_data__matches_stream_reader)
+{
+    const auto raw = to_chunk(base16_literal(
+        "0100000001f08e44a96bfb5ae63eda1a6620adae37ee37ee4777fb0336e1bbbc"
+        "4de65310fc010000006a473044022050d8368cacf9bf1b8fb1f7cfd9aff63294"
+        "789eb1760139e7ef41f083726dadc4022067796354aba8f2e02363c5e510aa7e"
+        "2830b115472fb31de67d16972867f13945012103e589480b2f746381fca01a9b"
+        "12c517b7a482a203c8b2742985da0ac72cc078f2ffffffff02f0c9c467000000"
+        "001976a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac80c4600f00"
+        "0000001976a9141ee32412020a324b93b1a1acfdfff6ab9ca8fac288ac000000"
+        "00"));
+
+    chain::transaction expected;
+    data_source stream(raw);
+    istream_reader stream_source(stream);
+    BOOST_REQUIRE(expected.from_data(stream_source));
+
+    chain::transaction instance;
+    byte_reader source(raw);
+    BOOST_REQUIRE(instance.from_data(source));
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(instance == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(monotonic_arena_tests)
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__constructor__default__empty)
+{
+    const monotonic_arena instance;
+    BOOST_REQUIRE_EQUAL(instance.blocks(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__within_block__one_block)
+{
+    monotonic_arena instance(64);
+    const auto first = static_cast<uint8_t*>(instance.allocate(8, 8));
+    const auto second = static_cast<uint8_t*>(instance.allocate(8, 8));
+    BOOST_REQUIRE_EQUAL(instance.blocks(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 64u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 16u);
+    BOOST_REQUIRE(second == first + 8);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__unaligned__padded)
+{
+    monotonic_arena instance(64);
+    const auto first = static_cast<uint8_t*>(instance.allocate(1, 1));
+    const auto second = static_cast<uint8_t*>(instance.allocate(4, 4));
+    BOOST_REQUIRE(second == first + 4);
+    BOOST_REQUIRE_EQUAL(instance.size(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_arena__allocate__exhausted__doubles)
+{
+    monotonic_arena instance(16);
+    instance.allocate(16);
+    instance.allocate(1);
+    BOOST_REQUIRE_EQUAL(instance.blocks(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 48u);
+    instance.allocate(100);
+    BOOST_REQUIRE_EQUAL(instance.blocks(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 148u);
+}
+
+BOOST_AUTO_TEST_CASE(arena_allocator__vector__arena__allocated_from_arena)
+{
+    const auto arena = std::make_shared<monotonic_arena>(1024);
+    std::vector<uint32_t, arena_allocator<uint32_t>> values(
+        arena_allocator<uint32_t>{ arena });
+    values.resize(10, 42);
+    BOOST_REQUIRE_EQUAL(arena->blocks(), 1u);
+    BOOST_REQUIRE_EQUAL(arena->size(), 40u);
+    BOOST_REQUIRE_EQUAL(values[9], 42u);
+}
+
+BOOST_AUTO_TEST_CASE(arena_allocator__vector__copy__not_allocated_from_arena)
+{
+    const auto arena = std::make_shared<monotonic_arena>(1024);
+    std::vector<uint32_t, arena_allocator<uint32_t>> values(
+        arena_allocator<uint32_t>{ arena });
+    values.resize(10, 42);
+    const auto copy = values;
+    BOOST_REQUIRE(!copy.get_allocator().arena());
+    BOOST_REQUIRE_EQUAL(arena->size(), 40u);
+    BOOST_REQUIRE(copy == values);
+}
+
+BOOST_AUTO_TEST_CASE(arena_allocator__vector__move__retains_arena)
+{
+    const auto arena = std::make_shared<monotonic_arena>(1024);
+    std::vector<uint32_t, arena_allocator<uint32_t>> values(
+        arena_allocator<uint32_t>{ arena });
+    values.resize(10, 42);
+    std::vector<uint32_t, arena_allocator<uint32_t>> moved;
+    moved = std::move(values);
+    BOOST_REQUIRE(moved.get_allocator().arena() == arena);
+    BOOST_REQUIRE_EQUAL(moved.size(), 10u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(parallel_for_tests)
+
+BOOST_AUTO_TEST_CASE(parallel_for__empty__success)
+{
+    threadpool pool(4);
+    const auto ec = parallel_for(pool, 0, [](size_t)
+    {
+        return error::operation_failed;
+    });
+
+    BOOST_REQUIRE_EQUAL(ec, error::success);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for__no_failure__each_index_once)
+{
+    threadpool pool(4);
+    std::vector<std::atomic<size_t>> counts(100);
+
+    for (auto& count: counts)
+        count = 0;
+
+    const auto ec = parallel_for(pool, counts.size(), [&](size_t index)
+    {
+        ++counts[index];
+        return error::success;
+    });
+
+    BOOST_REQUIRE_EQUAL(ec, error::success);
+
+    for (const auto& count: counts)
+        BOOST_REQUIRE_EQUAL(count.load(), 1u);
+
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for__multiple_failures__lowest_index_code)
+{
+    threadpool pool(4);
+    const auto ec = parallel_for(pool, 100, [](size_t index)
+    {
+        if (index == 80)
+            return code(error::operation_failed);
+
+        return index == 40 ? code(error::bad_stream) : code(error::success);
+    });
+
+    BOOST_REQUIRE_EQUAL(ec, error::bad_stream);
+    pool.shutdown();
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for__empty_pool__calling_thread_works)
+{
+    threadpool pool;
+    size_t total = 0;
+    const auto ec = parallel_for(pool, 10, [&](size_t index)
+    {
+        total += index;
+        return error::success;
+    });
+
+    BOOST_REQUIRE_EQUAL(ec, error::success);
+    BOOST_REQUIRE_EQUAL(total, 45u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
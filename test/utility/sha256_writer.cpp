@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(sha256_writer_tests)
+
+static data_chunk sequence(size_t size)
+{
+    data_chunk data(size);
+    for (size_t index = 0; index < size; ++index)
+        data[index] = static_cast<uint8_t>(index);
+
+    return data;
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__sha256_digest__empty__expected)
+{
+    const sha256_writer sink;
+    BOOST_REQUIRE_EQUAL(sink.size(), 0u);
+    BOOST_REQUIRE_EQUAL(encode_base16(sink.sha256_digest()), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__sha256_digest__block_boundaries__matches_sha256_hash)
+{
+    for (const auto size: { 1u, 55u, 56u, 63u, 64u, 65u, 127u, 128u, 1000u })
+    {
+        const auto data = sequence(size);
+        sha256_writer sink;
+        sink.write_bytes(data);
+        BOOST_REQUIRE_EQUAL(sink.size(), size);
+        BOOST_REQUIRE_EQUAL(encode_base16(sink.sha256_digest()), encode_base16(sha256_hash(data)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__bitcoin_digest__bytewise__matches_bitcoin_hash)
+{
+    const auto data = sequence(200);
+    sha256_writer sink;
+
+    for (const auto byte: data)
+        sink.write_byte(byte);
+
+    BOOST_REQUIRE_EQUAL(encode_base16(sink.bitcoin_digest()), encode_base16(bitcoin_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__bitcoin_digest__mixed_writes__matches_serialization)
+{
+    data_chunk data;
+    data_sink ostream(data);
+    ostream_writer expected(ostream);
+    sha256_writer sink;
+
+    const auto write = [](writer& out)
+    {
+        out.write_byte(0x80);
+        out.write_2_bytes_little_endian(0x8040);
+        out.write_4_bytes_big_endian(0x80402010);
+        out.write_8_bytes_little_endian(0x8040201011223344);
+        out.write_variable_little_endian(0x010000);
+        out.write_hash(null_hash);
+        out.write_string("hello");
+        out.write_string("pad", 12);
+        out.write_bytes(sequence(70));
+    };
+
+    write(expected);
+    ostream.flush();
+    write(sink);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE_EQUAL(sink.size(), data.size());
+    BOOST_REQUIRE_EQUAL(encode_base16(sink.bitcoin_digest()), encode_base16(bitcoin_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__sha256_digest__midstate__matches_sha256_hash)
+{
+    const auto data = sequence(150);
+    const auto midstate = sha256_midstate({ data.data(), data.data() + 128 });
+    sha256_writer sink(midstate, 2);
+    sink.write_bytes(data.data() + 128, data.size() - 128);
+    BOOST_REQUIRE_EQUAL(sink.size(), data.size());
+    BOOST_REQUIRE_EQUAL(encode_base16(sink.sha256_digest()), encode_base16(sha256_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__sha256_digest__repeated__does_not_reset)
+{
+    const auto data = sequence(100);
+    sha256_writer sink;
+    sink.write_bytes(data.data(), 50);
+    const auto partial = sink.sha256_digest();
+    BOOST_REQUIRE_EQUAL(encode_base16(partial), encode_base16(sink.sha256_digest()));
+    sink.write_bytes(data.data() + 50, 50);
+    BOOST_REQUIRE_EQUAL(encode_base16(sink.sha256_digest()), encode_base16(sha256_hash(data)));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_writer__skip__nulls__matches_sha256_hash)
+{
+    sha256_writer sink;
+    sink.skip(130);
+    BOOST_REQUIRE_EQUAL(encode_base16(sink.sha256_digest()), encode_base16(sha256_hash(data_chunk(130, 0x00))));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <deque>
+#include <numeric>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(shared_window_tests)
+
+typedef shared_window<uint32_t, 4> window;
+
+BOOST_AUTO_TEST_CASE(shared_window__construct__default__empty)
+{
+    const window instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__construct__deque__ordered)
+{
+    std::deque<uint32_t> values(10);
+    std::iota(values.begin(), values.end(), 0u);
+    const window instance(values.begin(), values.end());
+    BOOST_REQUIRE_EQUAL(instance.size(), values.size());
+    BOOST_REQUIRE(std::equal(values.begin(), values.end(), instance.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__assign__populated__replaced)
+{
+    window instance;
+    instance.push_back(42);
+    const std::vector<uint32_t> values{ 1, 2, 3, 4, 5 };
+    instance.assign(values.begin(), values.end());
+    BOOST_REQUIRE_EQUAL(instance.size(), values.size());
+    BOOST_REQUIRE(std::equal(values.begin(), values.end(), instance.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__multiple_chunks__ordered)
+{
+    window instance;
+
+    for (uint32_t value = 0; value < 10; ++value)
+        instance.push_back(value);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 9u);
+
+    for (uint32_t value = 0; value < 10; ++value)
+        BOOST_REQUIRE_EQUAL(instance[value], value);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__pop_front__across_chunks__expected)
+{
+    window instance;
+
+    for (uint32_t value = 0; value < 10; ++value)
+        instance.push_back(value);
+
+    for (auto count = 0; count < 6; ++count)
+        instance.pop_front();
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 6u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 9u);
+
+    instance.push_back(10);
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance[4], 10u);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__pop_front__to_empty__reusable)
+{
+    window instance;
+    instance.push_back(1);
+    instance.push_back(2);
+    instance.pop_front();
+    instance.pop_front();
+    BOOST_REQUIRE(instance.empty());
+
+    instance.push_back(3);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__diverged_copies__independent)
+{
+    window parent;
+    parent.push_back(1);
+    parent.push_back(2);
+
+    auto left = parent;
+    auto right = parent;
+    left.push_back(3);
+    right.push_back(4);
+    right.push_back(5);
+
+    BOOST_REQUIRE_EQUAL(parent.size(), 2u);
+    BOOST_REQUIRE_EQUAL(parent.back(), 2u);
+    BOOST_REQUIRE_EQUAL(left.size(), 3u);
+    BOOST_REQUIRE_EQUAL(left.back(), 3u);
+    BOOST_REQUIRE_EQUAL(right.size(), 4u);
+    BOOST_REQUIRE_EQUAL(right[2], 4u);
+    BOOST_REQUIRE_EQUAL(right[3], 5u);
+
+    // The parent diverges from both children after they have appended.
+    parent.push_back(6);
+    BOOST_REQUIRE_EQUAL(parent.back(), 6u);
+    BOOST_REQUIRE_EQUAL(left.back(), 3u);
+    BOOST_REQUIRE_EQUAL(right[2], 4u);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__pop_front__copy__parent_unchanged)
+{
+    window parent;
+
+    for (uint32_t value = 0; value < 8; ++value)
+        parent.push_back(value);
+
+    auto child = parent;
+
+    for (auto count = 0; count < 5; ++count)
+        child.pop_front();
+
+    BOOST_REQUIRE_EQUAL(child.size(), 3u);
+    BOOST_REQUIRE_EQUAL(child.front(), 5u);
+    BOOST_REQUIRE_EQUAL(parent.size(), 8u);
+    BOOST_REQUIRE_EQUAL(parent.front(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__reverse_iterate__expected)
+{
+    window instance;
+
+    for (uint32_t value = 0; value < 6; ++value)
+        instance.push_back(value);
+
+    instance.pop_front();
+    uint32_t expected = 5;
+
+    for (auto it = instance.crbegin(); it != instance.crend(); ++it)
+        BOOST_REQUIRE_EQUAL(*it, expected--);
+
+    BOOST_REQUIRE_EQUAL(expected, 0u);
+    BOOST_REQUIRE_EQUAL(std::distance(instance.begin(), instance.end()), 5);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__clear__populated__empty)
+{
+    window instance;
+    instance.push_back(42);
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
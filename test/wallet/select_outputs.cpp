@@ -30,4 +30,96 @@ BOOST_AUTO_TEST_SUITE(select_outputs_tests)
 ////    BOOST_REQUIRE(true);
 ////}
 
+static const chain::point_value::list unspent_values
+{
+    { { null_hash, 0u }, 5u },
+    { { null_hash, 1u }, 9u },
+    { { null_hash, 2u }, 12u },
+    { { null_hash, 3u }, 20u },
+    { { null_hash, 4u }, 50u }
+};
+
+static uint64_t total(const chain::points_value& points)
+{
+    return points.value();
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__index_greedy_single_sufficient__smallest)
+{
+    const chain::points_index unspent(unspent_values);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 15u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out.points.front().value(), 20u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__index_greedy_combined__descending)
+{
+    const chain::points_index unspent(unspent_values);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 75u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 3u);
+    BOOST_REQUIRE_EQUAL(total(out), 82u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__index_greedy_insufficient__empty)
+{
+    const chain::points_index unspent(unspent_values);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 97u);
+    BOOST_REQUIRE(out.points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__index_individual__ascending_sufficient)
+{
+    const chain::points_index unspent(unspent_values);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 12u, select_outputs::algorithm::individual);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 3u);
+    BOOST_REQUIRE_EQUAL(out.points[0].value(), 12u);
+    BOOST_REQUIRE_EQUAL(out.points[2].value(), 50u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_exact__change_free)
+{
+    const chain::points_value unspent{ unspent_values };
+    chain::points_value out;
+    select_outputs::select(out, unspent, 26u, select_outputs::algorithm::branch_and_bound);
+    BOOST_REQUIRE_EQUAL(total(out), 26u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_no_exact__empty)
+{
+    const chain::points_value unspent{ unspent_values };
+    chain::points_value out;
+    select_outputs::select(out, unspent, 4u, select_outputs::algorithm::branch_and_bound);
+    BOOST_REQUIRE(out.points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_fees__within_window)
+{
+    // Effective values are 3, 7, 10, 18 and 48 with an input fee of 2.
+    const chain::points_index unspent(unspent_values);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 30u, select_outputs::algorithm::branch_and_bound, 2u, 2u);
+    BOOST_REQUIRE(!out.points.empty());
+
+    const auto effective = total(out) - 2u * out.points.size();
+    BOOST_REQUIRE_GE(effective, 30u);
+    BOOST_REQUIRE_LE(effective, 32u);
+}
+
+BOOST_AUTO_TEST_CASE(select_outputs__select__branch_and_bound_fee_exceeds_value__excluded)
+{
+    const chain::points_index unspent(unspent_values);
+    chain::points_value out;
+    select_outputs::select(out, unspent, 5u, select_outputs::algorithm::branch_and_bound, 5u, 0u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 0u);
+
+    select_outputs::select(out, unspent, 4u, select_outputs::algorithm::branch_and_bound, 5u, 0u);
+    BOOST_REQUIRE_EQUAL(out.points.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out.points.front().value(), 9u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()